@@ -206,6 +206,47 @@ extern "C" {
  */
 #define DEVICE_DECLARE(name) static struct device DEVICE_NAME_GET(name)
 
+/**
+ * @def DEVICE_INIT_ASYNC
+ *
+ * @brief Allow a device to be initialized in parallel with others
+ *
+ * @details With CONFIG_DEVICE_INIT_PARALLEL, the init function of a
+ * POST_KERNEL or APPLICATION level device marked with this macro is run
+ * on a boot worker thread, concurrently with the following devices that
+ * are also marked, until the next unmarked device.  Unmarked devices act
+ * as barriers: they are only initialized once all marked devices before
+ * them are done, and marked devices after them are only started once
+ * they are done.  A marked device is therefore guaranteed that all
+ * unmarked devices initialized before it are ready, but not that marked
+ * ones are, unless they are listed as dependencies.
+ *
+ * Parallel init only saves time when init functions block (e.g. sleep
+ * while waiting for hardware) or on SMP systems.  The macro is ignored
+ * for PRE_KERNEL devices and without CONFIG_DEVICE_INIT_PARALLEL.
+ *
+ * Must be used in the file that defines the device.
+ *
+ * @param dev_name The dev_name the device was defined with
+ * @param ... Names (as passed to device_get_binding()) of devices that
+ * must be initialized first.  They must come before this device in init
+ * order.
+ */
+#ifdef CONFIG_DEVICE_INIT_PARALLEL
+#define DEVICE_INIT_ASYNC(dev_name, ...)				  \
+	static const char * const _CONCAT(__init_deps_, dev_name)[] = {  \
+		__VA_ARGS__						  \
+	};								  \
+	static struct device_init_async _CONCAT(__init_async_, dev_name) \
+	__used __in_section(_device_init_async, static, dev_name) = {	  \
+		.dev = DEVICE_GET(dev_name),				  \
+		.deps = _CONCAT(__init_deps_, dev_name),		  \
+		.num_deps = ARRAY_SIZE(_CONCAT(__init_deps_, dev_name)),  \
+	}
+#else
+#define DEVICE_INIT_ASYNC(dev_name, ...)
+#endif
+
 struct device;
 
 
@@ -247,8 +288,43 @@ struct device {
 #endif
 };
 
+#ifdef CONFIG_DEVICE_INIT_PARALLEL
+/* Created by DEVICE_INIT_ASYNC() */
+struct device_init_async {
+	void *fifo_reserved;
+	struct device *dev;
+	const char * const *deps;
+	u8_t num_deps;
+	atomic_t done;
+};
+#endif
+
 void z_sys_device_do_config_level(s32_t level);
 
+#ifdef CONFIG_DEVICE_INIT_TIMING
+/**
+ * @brief Get the time a device's init function took
+ *
+ * @param dev Device
+ *
+ * @return Hardware cycles spent in the device's init function at boot,
+ * 0 if it has not been initialized yet.
+ */
+u32_t device_init_cycles_get(struct device *dev);
+
+/**
+ * @brief Get the time device initialization took at an init level
+ *
+ * With parallel device initialization, this is less than the sum of
+ * the levels' device_init_cycles_get().
+ *
+ * @param level Init level (_SYS_INIT_LEVEL_*)
+ *
+ * @return Hardware cycles spent initializing the level's devices.
+ */
+u32_t device_init_level_cycles_get(s32_t level);
+#endif
+
 /**
  * @brief Retrieve the device structure for a driver by name
  *
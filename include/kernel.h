@@ -450,6 +450,11 @@ struct _thread_base {
 	/* CPU index on which thread was last run */
 	u8_t cpu;
 
+#ifdef CONFIG_SCHED_CPU_RUNQ
+	/* CPU whose ready queue holds (or will hold) the thread */
+	u8_t runq_cpu;
+#endif
+
 	/* Recursive count of irq_lock() calls */
 	u8_t global_lock_count;
 
@@ -1740,6 +1745,14 @@ struct k_queue {
 		_POLL_EVENT;
 	};
 
+#ifdef CONFIG_QUEUE_LOCKFREE_APPEND
+	/* Items appended without taking the lock, newest first */
+	sys_sfnode_t *incoming;
+
+	/* Threads pended on or polling the queue */
+	atomic_t waiters;
+#endif
+
 	_OBJECT_TRACING_NEXT_PTR(k_queue)
 };
 
@@ -1755,6 +1768,15 @@ struct k_queue {
 
 extern void *z_queue_node_peek(sys_sfnode_t *node, bool needs_free);
 
+#ifdef CONFIG_QUEUE_LOCKFREE_APPEND
+extern void z_queue_flush_incoming(struct k_queue *queue);
+#else
+static inline void z_queue_flush_incoming(struct k_queue *queue)
+{
+	ARG_UNUSED(queue);
+}
+#endif
+
 /**
  * INTERNAL_HIDDEN @endcond
  */
@@ -1943,6 +1965,7 @@ __syscall void *k_queue_get(struct k_queue *queue, s32_t timeout);
  */
 static inline bool k_queue_remove(struct k_queue *queue, void *data)
 {
+	z_queue_flush_incoming(queue);
 	return sys_sflist_find_and_remove(&queue->data_q, (sys_sfnode_t *)data);
 }
 
@@ -1964,6 +1987,7 @@ static inline bool k_queue_unique_append(struct k_queue *queue, void *data)
 {
 	sys_sfnode_t *test;
 
+	z_queue_flush_incoming(queue);
 	SYS_SFLIST_FOR_EACH_NODE(&queue->data_q, test) {
 		if (test == (sys_sfnode_t *) data) {
 			return false;
@@ -1991,6 +2015,11 @@ __syscall int k_queue_is_empty(struct k_queue *queue);
 
 static inline int z_impl_k_queue_is_empty(struct k_queue *queue)
 {
+#ifdef CONFIG_QUEUE_LOCKFREE_APPEND
+	if (queue->incoming != NULL) {
+		return 0;
+	}
+#endif
 	return (int)sys_sflist_is_empty(&queue->data_q);
 }
 
@@ -2007,6 +2036,7 @@ __syscall void *k_queue_peek_head(struct k_queue *queue);
 
 static inline void *z_impl_k_queue_peek_head(struct k_queue *queue)
 {
+	z_queue_flush_incoming(queue);
 	return z_queue_node_peek(sys_sflist_peek_head(&queue->data_q), false);
 }
 
@@ -2023,6 +2053,7 @@ __syscall void *k_queue_peek_tail(struct k_queue *queue);
 
 static inline void *z_impl_k_queue_peek_tail(struct k_queue *queue)
 {
+	z_queue_flush_incoming(queue);
 	return z_queue_node_peek(sys_sflist_peek_tail(&queue->data_q), false);
 }
 
@@ -2550,6 +2581,9 @@ struct k_delayed_work {
 	struct k_work work;
 	struct _timeout timeout;
 	struct k_work_q *work_q;
+#ifdef CONFIG_TIMEOUT_SLACK
+	s32_t slack;
+#endif
 };
 
 extern struct k_work_q k_sys_work_q;
@@ -2802,6 +2836,43 @@ extern int k_delayed_work_submit_to_queue(struct k_work_q *work_q,
  */
 extern int k_delayed_work_cancel(struct k_delayed_work *work);
 
+#ifdef CONFIG_TIMEOUT_SLACK
+/**
+ * @brief Set the slack of a delayed work item.
+ *
+ * This routine lets later submissions of delayed work item @a work
+ * expire up to @a slack milliseconds after their requested delay.  The
+ * kernel uses that freedom to place the expiry on a tick shared with
+ * other delayed work items, so that items due at nearly the same time
+ * cost one wakeup instead of one each.  It never expires early.
+ *
+ * The slack applies from the next submission on; a slack of 0 (the
+ * default) restores exact expiry.
+ *
+ * @note Requires CONFIG_TIMEOUT_SLACK.
+ *
+ * @param work Address of delayed work item.
+ * @param slack Tolerated lateness (in milliseconds).
+ *
+ * @return N/A
+ */
+extern void k_delayed_work_slack_set(struct k_delayed_work *work,
+				     s32_t slack);
+
+/**
+ * @brief Get the number of timer wakeups saved by coalescing.
+ *
+ * Each time several timeouts (of any kind) expire in the same timer
+ * announcement, all but the first of them are counted as a saved
+ * wakeup.
+ *
+ * @note Requires CONFIG_TIMEOUT_SLACK.
+ *
+ * @return Number of wakeups saved since boot.
+ */
+extern u32_t k_timeout_wakeups_saved(void);
+#endif
+
 /**
  * @brief Submit a work item to the system workqueue.
  *
@@ -3162,6 +3233,12 @@ struct k_msgq {
 	char *read_ptr;
 	char *write_ptr;
 	u32_t used_msgs;
+#ifdef CONFIG_MSGQ_PRIORITY
+	/* Urgent messages queued ahead of read_ptr's regular ones */
+	u32_t urgent_msgs;
+	/* Threads blocked in k_msgq_put_urgent() */
+	_wait_q_t urgent_wait_q;
+#endif
 
 	_OBJECT_TRACING_NEXT_PTR(k_msgq)
 	u8_t flags;
@@ -3171,6 +3248,14 @@ struct k_msgq {
  */
 
 
+#ifdef CONFIG_MSGQ_PRIORITY
+#define _K_MSGQ_URGENT_INIT(obj) \
+	.urgent_msgs = 0, \
+	.urgent_wait_q = Z_WAIT_Q_INIT(&obj.urgent_wait_q),
+#else
+#define _K_MSGQ_URGENT_INIT(obj)
+#endif
+
 #define _K_MSGQ_INITIALIZER(obj, q_buffer, q_msg_size, q_max_msgs) \
 	{ \
 	.wait_q = Z_WAIT_Q_INIT(&obj.wait_q), \
@@ -3181,6 +3266,7 @@ struct k_msgq {
 	.read_ptr = q_buffer, \
 	.write_ptr = q_buffer, \
 	.used_msgs = 0, \
+	_K_MSGQ_URGENT_INIT(obj) \
 	_OBJECT_TRACING_INIT \
 	}
 #define K_MSGQ_INITIALIZER DEPRECATED_MACRO _K_MSGQ_INITIALIZER
@@ -3317,6 +3403,88 @@ __syscall int k_msgq_put(struct k_msgq *q, void *data, s32_t timeout);
  */
 __syscall int k_msgq_get(struct k_msgq *q, void *data, s32_t timeout);
 
+/**
+ * @brief Send several messages to a message queue.
+ *
+ * This routine sends up to @a num messages, stored back to back at
+ * @a data, to message queue @a q.  All messages that fit are moved in a
+ * single critical section, any threads waiting to receive are handed
+ * their message directly and woken together, and at most one reschedule
+ * is done.  The messages keep their order.
+ *
+ * If no message can be sent right away, the routine waits up to
+ * @a timeout for room for the first one only, and then returns 1.
+ *
+ * @note Can be called by ISRs, but @a timeout must be set to K_NO_WAIT.
+ *
+ * @param q Address of the message queue.
+ * @param data Pointer to the messages.
+ * @param num Number of messages at @a data.
+ * @param timeout Waiting period to add the first message (in
+ *                milliseconds), or one of the special values K_NO_WAIT
+ *                and K_FOREVER.
+ *
+ * @return Number of messages sent (at least 1 unless @a num is 0),
+ *         -ENOMSG if returned without waiting or the queue was purged,
+ *         or -EAGAIN if the waiting period timed out.
+ */
+__syscall int k_msgq_put_many(struct k_msgq *q, void *data, u32_t num,
+			      s32_t timeout);
+
+/**
+ * @brief Receive several messages from a message queue.
+ *
+ * This routine receives up to @a num messages from message queue @a q
+ * into the buffer at @a data, in the same order k_msgq_get() would
+ * return them.  All messages are moved in a single critical section,
+ * threads blocked sending to the full queue are admitted as space frees
+ * up and woken together, and at most one reschedule is done.
+ *
+ * If the queue is empty, the routine waits up to @a timeout for one
+ * message, and then returns 1.
+ *
+ * @note Can be called by ISRs, but @a timeout must be set to K_NO_WAIT.
+ *
+ * @param q Address of the message queue.
+ * @param data Address of area to hold @a num messages.
+ * @param num Maximum number of messages to receive.
+ * @param timeout Waiting period to receive the first message (in
+ *                milliseconds), or one of the special values K_NO_WAIT
+ *                and K_FOREVER.
+ *
+ * @return Number of messages received (at least 1 unless @a num is 0),
+ *         -ENOMSG if returned without waiting, or -EAGAIN if the
+ *         waiting period timed out.
+ */
+__syscall int k_msgq_get_many(struct k_msgq *q, void *data, u32_t num,
+			      s32_t timeout);
+
+/**
+ * @brief Send an urgent message to a message queue.
+ *
+ * This routine works like k_msgq_put(), but the message is queued ahead
+ * of all regular messages: it is received after any urgent messages
+ * sent before it and before all regular ones.  If the queue is full,
+ * threads waiting in this routine are admitted before threads waiting
+ * in k_msgq_put() once space frees up.
+ *
+ * Queueing an urgent message moves the urgent messages already in the
+ * queue, so this is meant for occasional control messages.
+ *
+ * @note Requires CONFIG_MSGQ_PRIORITY.
+ * @note Can be called by ISRs, but @a timeout must be set to K_NO_WAIT.
+ *
+ * @param q Address of the message queue.
+ * @param data Pointer to the message.
+ * @param timeout Waiting period to add the message (in milliseconds),
+ *                or one of the special values K_NO_WAIT and K_FOREVER.
+ *
+ * @retval 0 Message sent.
+ * @retval -ENOMSG Returned without waiting or queue purged.
+ * @retval -EAGAIN Waiting period timed out.
+ */
+__syscall int k_msgq_put_urgent(struct k_msgq *q, void *data, s32_t timeout);
+
 /**
  * @brief Peek/read a message from a message queue.
  *
@@ -3637,6 +3805,8 @@ struct k_pipe {
 	size_t         bytes_used;      /**< # bytes used in buffer */
 	size_t         read_index;      /**< Where in buffer to read from */
 	size_t         write_index;     /**< Where in buffer to write */
+	size_t         put_claimed;     /**< # bytes claimed for writing */
+	size_t         get_claimed;     /**< # bytes claimed for reading */
 	struct k_spinlock lock;		/**< Synchronization lock */
 
 	struct {
@@ -3660,6 +3830,8 @@ struct k_pipe {
 	.bytes_used = 0,                                            \
 	.read_index = 0,                                            \
 	.write_index = 0,                                           \
+	.put_claimed = 0,                                           \
+	.get_claimed = 0,                                           \
 	.lock = {},                                                 \
 	.wait_q = {                                                 \
 		.readers = Z_WAIT_Q_INIT(&obj.wait_q.readers),       \
@@ -3808,12 +3980,115 @@ __syscall int k_pipe_get(struct k_pipe *pipe, void *data,
 extern void k_pipe_block_put(struct k_pipe *pipe, struct k_mem_block *block,
 			     size_t size, struct k_sem *sem);
 
+/**
+ * @brief Claim contiguous space in a pipe's buffer for writing.
+ *
+ * Zero-copy alternative to k_pipe_put(): the caller writes directly
+ * into the pipe's buffer and then makes the data available to readers
+ * with k_pipe_put_commit().  At most @a size bytes are claimed; fewer
+ * may be returned if the free space wraps around the end of the buffer.
+ * If the buffer is full, the call waits for space to become available.
+ *
+ * Only one put claim can be outstanding at a time, and the pipe must
+ * not be written to with k_pipe_put() until it has been committed.
+ * Readers may use either k_pipe_get() or k_pipe_get_claim().  The pipe
+ * must have a buffer.  This API is not available to user mode threads.
+ *
+ * @param pipe Address of the pipe.
+ * @param data Set to the start of the claimed space.
+ * @param size In: maximum number of bytes to claim.  Out: number of bytes
+ *             actually claimed.
+ * @param timeout Waiting period to wait for space (in milliseconds), or
+ *                one of the special values K_NO_WAIT and K_FOREVER.
+ *
+ * @retval 0 At least one byte was claimed.
+ * @retval -EIO Returned without waiting; the buffer is full.
+ * @retval -EAGAIN Waiting period timed out.
+ * @retval -EBUSY A put claim is already outstanding.
+ */
+extern int k_pipe_put_claim(struct k_pipe *pipe, void **data, size_t *size,
+			    s32_t timeout);
+
+/**
+ * @brief Commit data written into space claimed with k_pipe_put_claim().
+ *
+ * The first @a size bytes of the claimed space become readable, in
+ * order after any previously written data, and waiting readers are
+ * woken up.  The rest of the claim is released.
+ *
+ * @param pipe Address of the pipe.
+ * @param size Number of bytes written, at most the claimed size.
+ *
+ * @retval 0 Data committed.
+ * @retval -EINVAL @a size exceeds the claimed size.
+ */
+extern int k_pipe_put_commit(struct k_pipe *pipe, size_t size);
+
+/**
+ * @brief Claim contiguous data in a pipe's buffer for reading.
+ *
+ * Zero-copy alternative to k_pipe_get(): the caller processes data in
+ * place and then frees the space with k_pipe_get_commit().  At most
+ * @a size bytes are claimed; fewer may be returned if the data wraps
+ * around the end of the buffer.  If the buffer is empty, the call waits
+ * for data to become available.
+ *
+ * Only one get claim can be outstanding at a time, and the pipe must
+ * not be read with k_pipe_get() until it has been committed.  Writers
+ * may use either k_pipe_put() or k_pipe_put_claim().  The pipe must
+ * have a buffer.  This API is not available to user mode threads.
+ *
+ * @param pipe Address of the pipe.
+ * @param data Set to the start of the claimed data.
+ * @param size In: maximum number of bytes to claim.  Out: number of bytes
+ *             actually claimed.
+ * @param timeout Waiting period to wait for data (in milliseconds), or
+ *                one of the special values K_NO_WAIT and K_FOREVER.
+ *
+ * @retval 0 At least one byte was claimed.
+ * @retval -EIO Returned without waiting; the buffer is empty.
+ * @retval -EAGAIN Waiting period timed out.
+ * @retval -EBUSY A get claim is already outstanding.
+ */
+extern int k_pipe_get_claim(struct k_pipe *pipe, void **data, size_t *size,
+			    s32_t timeout);
+
+/**
+ * @brief Release data claimed with k_pipe_get_claim().
+ *
+ * The first @a size bytes of the claimed data are consumed and their
+ * space is handed to waiting writers.  The rest of the claim stays in
+ * the pipe and is read next.
+ *
+ * @param pipe Address of the pipe.
+ * @param size Number of bytes consumed, at most the claimed size.
+ *
+ * @retval 0 Data consumed.
+ * @retval -EINVAL @a size exceeds the claimed size.
+ */
+extern int k_pipe_get_commit(struct k_pipe *pipe, size_t size);
+
 /** @} */
 
 /**
  * @cond INTERNAL_HIDDEN
  */
 
+#ifdef CONFIG_MEM_SLAB_CPU_CACHE
+/* Per-CPU magazine: a small LIFO of free blocks */
+struct z_mem_slab_mag {
+	struct k_spinlock lock;
+	u32_t count;
+	char *blocks[CONFIG_MEM_SLAB_CPU_CACHE_SIZE];
+};
+
+struct z_mem_slab_cache {
+	/* Allocators that found the slab empty and may pend on it */
+	atomic_t waiters;
+	struct z_mem_slab_mag mags[CONFIG_MP_NUM_CPUS];
+};
+#endif
+
 struct k_mem_slab {
 	_wait_q_t wait_q;
 	u32_t num_blocks;
@@ -3821,6 +4096,9 @@ struct k_mem_slab {
 	char *buffer;
 	char *free_list;
 	u32_t num_used;
+#ifdef CONFIG_MEM_SLAB_CPU_CACHE
+	struct z_mem_slab_cache *cache;
+#endif
 
 	_OBJECT_TRACING_NEXT_PTR(k_mem_slab)
 };
@@ -3837,6 +4115,21 @@ struct k_mem_slab {
 	_OBJECT_TRACING_INIT \
 	}
 
+#ifdef CONFIG_MEM_SLAB_CPU_CACHE
+#define _K_MEM_SLAB_CACHED_INITIALIZER(obj, slab_buffer, slab_block_size, \
+				       slab_num_blocks, slab_cache) \
+	{ \
+	.wait_q = Z_WAIT_Q_INIT(&obj.wait_q), \
+	.num_blocks = slab_num_blocks, \
+	.block_size = slab_block_size, \
+	.buffer = slab_buffer, \
+	.free_list = NULL, \
+	.num_used = 0, \
+	.cache = slab_cache, \
+	_OBJECT_TRACING_INIT \
+	}
+#endif
+
 #define K_MEM_SLAB_INITIALIZER DEPRECATED_MACRO _K_MEM_SLAB_INITIALIZER
 
 
@@ -3878,6 +4171,44 @@ struct k_mem_slab {
 		_K_MEM_SLAB_INITIALIZER(name, _k_mem_slab_buf_##name, \
 				      slab_block_size, slab_num_blocks)
 
+/**
+ * @brief Statically define and initialize a memory slab with per-CPU caches.
+ *
+ * Same as K_MEM_SLAB_DEFINE(), but allocations and frees first go through
+ * a small per-CPU magazine of free blocks, which is refilled from and
+ * drained to the shared free list in batches. This keeps the common path
+ * off the global memory slab lock when several CPUs hammer the same slab.
+ *
+ * Blocks parked in a magazine still count as free: k_mem_slab_num_used_get()
+ * reports exactly the number of blocks held by users, and an allocation
+ * that finds the shared free list empty reclaims blocks cached on other
+ * CPUs before failing or waiting.
+ *
+ * Without CONFIG_MEM_SLAB_CPU_CACHE this is equivalent to
+ * K_MEM_SLAB_DEFINE().
+ *
+ * @param name Name of the memory slab.
+ * @param slab_block_size Size of each memory block (in bytes).
+ * @param slab_num_blocks Number memory blocks.
+ * @param slab_align Alignment of the memory slab's buffer (power of 2).
+ */
+#ifdef CONFIG_MEM_SLAB_CPU_CACHE
+#define K_MEM_SLAB_DEFINE_CACHED(name, slab_block_size, slab_num_blocks, \
+				 slab_align) \
+	char __noinit __aligned(slab_align) \
+		_k_mem_slab_buf_##name[(slab_num_blocks) * (slab_block_size)]; \
+	static struct z_mem_slab_cache _k_mem_slab_cache_##name; \
+	struct k_mem_slab name \
+		__in_section(_k_mem_slab, static, name) = \
+		_K_MEM_SLAB_CACHED_INITIALIZER(name, _k_mem_slab_buf_##name, \
+					       slab_block_size, slab_num_blocks, \
+					       &_k_mem_slab_cache_##name)
+#else
+#define K_MEM_SLAB_DEFINE_CACHED(name, slab_block_size, slab_num_blocks, \
+				 slab_align) \
+	K_MEM_SLAB_DEFINE(name, slab_block_size, slab_num_blocks, slab_align)
+#endif
+
 /**
  * @brief Initialize a memory slab.
  *
@@ -3975,6 +4306,9 @@ static inline u32_t k_mem_slab_num_free_get(struct k_mem_slab *slab)
 struct k_mem_pool {
 	struct sys_mem_pool_base base;
 	_wait_q_t wait_q;
+#ifdef CONFIG_MEM_POOL_TLSF
+	struct sys_tlsf tlsf;
+#endif
 };
 
 /**
@@ -4006,6 +4340,19 @@ struct k_mem_pool {
  * @param align Alignment of the pool's buffer (power of 2).
  * @req K-MPOOL-001
  */
+#ifdef CONFIG_MEM_POOL_TLSF
+#define K_MEM_POOL_DEFINE(name, minsz, maxsz, nmax, align)		\
+	char __aligned(align)						\
+		_mpool_buf_##name[SYS_TLSF_ARENA_SIZE(maxsz, nmax)];	\
+	struct k_mem_pool name __in_section(_k_mem_pool, static, name) = { \
+		.base = {						\
+			.buf = _mpool_buf_##name,			\
+			.max_sz = maxsz,				\
+			.n_max = nmax,					\
+			.flags = SYS_MEM_POOL_KERNEL			\
+		} \
+	}
+#else
 #define K_MEM_POOL_DEFINE(name, minsz, maxsz, nmax, align)		\
 	char __aligned(align) _mpool_buf_##name[_ALIGN4(maxsz * nmax)	\
 				  + _MPOOL_BITS_SIZE(maxsz, minsz, nmax)]; \
@@ -4020,6 +4367,7 @@ struct k_mem_pool {
 			.flags = SYS_MEM_POOL_KERNEL			\
 		} \
 	}
+#endif
 
 /**
  * @brief Allocate memory from a memory pool.
@@ -4284,6 +4632,11 @@ struct k_poll_event {
 		struct k_fifo *fifo;
 		struct k_queue *queue;
 	};
+
+#ifdef CONFIG_POLL_SET
+	/* PRIVATE - DO NOT TOUCH */
+	sys_dnode_t _ready_node;
+#endif
 };
 
 #define K_POLL_EVENT_INITIALIZER(event_type, event_mode, event_obj) \
@@ -4438,6 +4791,95 @@ __syscall void k_poll_signal_check(struct k_poll_signal *signal,
 
 __syscall int k_poll_signal_raise(struct k_poll_signal *signal, int result);
 
+#ifdef CONFIG_POLL_SET
+
+/* public - poll set flags */
+#define K_POLL_SET_EDGE BIT(0)
+
+/* public - persistent poll set object */
+struct k_poll_set {
+	/* PRIVATE - DO NOT TOUCH */
+	struct k_spinlock lock;
+	struct _poller poller;
+	sys_dlist_t ready;
+	_wait_q_t wait_q;
+	u32_t flags;
+};
+
+/**
+ * @brief Initialize a poll set.
+ *
+ * A poll set is a persistent alternative to k_poll(): events are
+ * registered once with k_poll_set_add() and stay registered across
+ * waits.  Each k_poll_set_wait() only looks at the events that were
+ * signaled, instead of registering and unregistering every event.
+ *
+ * By default the set is level-triggered: an event is returned by every
+ * wait for as long as its condition holds (semaphore available, queue
+ * not empty, signal raised).  With K_POLL_SET_EDGE an event is returned
+ * once per transition, and is only returned again after its object
+ * signals it again.  Repeated signals of an event that has not been
+ * returned yet are coalesced into a single report whose state
+ * accumulates all signaled states.
+ *
+ * Poll sets cannot be used from user mode.
+ *
+ * @param set Poll set to initialize.
+ * @param flags 0 or K_POLL_SET_EDGE.
+ *
+ * @return N/A
+ */
+extern void k_poll_set_init(struct k_poll_set *set, u32_t flags);
+
+/**
+ * @brief Add an event to a poll set.
+ *
+ * The event must have been initialized with k_poll_event_init() or one
+ * of the initializer macros, and must not be passed to k_poll() or
+ * another set while it belongs to this one.  If the event's condition
+ * already holds, it is reported by the next wait.
+ *
+ * @param set Poll set.
+ * @param event Event to add.
+ *
+ * @return N/A
+ */
+extern void k_poll_set_add(struct k_poll_set *set, struct k_poll_event *event);
+
+/**
+ * @brief Remove an event from a poll set.
+ *
+ * @param set Poll set.
+ * @param event Event previously added with k_poll_set_add().
+ *
+ * @return N/A
+ */
+extern void k_poll_set_remove(struct k_poll_set *set,
+			      struct k_poll_event *event);
+
+/**
+ * @brief Wait for events of a poll set to become ready.
+ *
+ * Up to @a max_events ready events are stored in @a events, in the order
+ * they became ready.  The state field of each returned event tells what
+ * happened, as with k_poll().  Unlike with k_poll() the state does not
+ * need to be reset by the caller.
+ *
+ * @param set Poll set.
+ * @param events Array receiving pointers to the ready events.
+ * @param max_events Size of @a events.
+ * @param timeout Waiting period (in milliseconds), or one of the special
+ *                values K_NO_WAIT and K_FOREVER.
+ *
+ * @return Number of events stored in @a events (at least one).
+ * @retval -EAGAIN No event became ready within @a timeout.
+ */
+extern int k_poll_set_wait(struct k_poll_set *set,
+			   struct k_poll_event **events, int max_events,
+			   s32_t timeout);
+
+#endif /* CONFIG_POLL_SET */
+
 /**
  * @internal
  */
@@ -32,9 +32,10 @@
  * the number of devices, we go through the below mechanism to allocate the
  * required space.
  */
-#ifdef CONFIG_DEVICE_POWER_MANAGEMENT
 #define DEVICE_COUNT \
 	((__device_init_end - __device_init_start) / _DEVICE_STRUCT_SIZEOF)
+
+#ifdef CONFIG_DEVICE_POWER_MANAGEMENT
 #define DEV_BUSY_SZ	(((DEVICE_COUNT + 31) / 32) * 4)
 #define DEVICE_BUSY_BITFIELD()			\
 		FILL(0x00) ;			\
@@ -45,6 +46,17 @@
 #define DEVICE_BUSY_BITFIELD()
 #endif
 
+/* Per device init duration, same mechanism as the busy bitmap */
+#ifdef CONFIG_DEVICE_INIT_TIMING
+#define DEVICE_INIT_TIMES()				\
+		FILL(0x00) ;				\
+		__device_init_cycles_start = .;		\
+		. = . + DEVICE_COUNT * 4;		\
+		__device_init_cycles_end = .;
+#else
+#define DEVICE_INIT_TIMES()
+#endif
+
 /*
  * generate a symbol to mark the start of the device initialization objects for
  * the specified level, then link all of those objects (sorted by priority);
@@ -70,6 +82,7 @@
 		DEVICE_INIT_LEVEL(APPLICATION)	\
 		__device_init_end = .;		\
 		DEVICE_BUSY_BITFIELD()		\
+		DEVICE_INIT_TIMES()		\
 
 
 /* define a section for undefined device initialization levels */
@@ -0,0 +1,110 @@
+/*
+ * Copyright (c) 2019 Intel Corporation
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef ZEPHYR_INCLUDE_MISC_TLSF_H_
+#define ZEPHYR_INCLUDE_MISC_TLSF_H_
+
+#include <zephyr/types.h>
+#include <stddef.h>
+
+/*
+ * Two-Level Segregated Fit heap.
+ *
+ * Free blocks are kept in size-segregated lists indexed by a first
+ * level (power of two) and a second level (SYS_TLSF_SL_COUNT linear
+ * subdivisions of that power of two), with a bitmap per level.  Both
+ * allocation and free take a bounded number of steps, independent of
+ * heap size and fragmentation, and the worst-case internal rounding
+ * is 1/SYS_TLSF_SL_COUNT of the request.
+ *
+ * The heap itself is not synchronized; callers provide locking.
+ */
+
+#ifdef CONFIG_SYS_TLSF
+
+#define SYS_TLSF_SL_LOG2	3
+#define SYS_TLSF_SL_COUNT	(1 << SYS_TLSF_SL_LOG2)
+
+/* Block alignment and header size: two pointers */
+#define Z_TLSF_ALIGN		(2 * sizeof(void *))
+#define Z_TLSF_ALIGN_LOG2	(sizeof(void *) == 8 ? 4 : 3)
+#define Z_TLSF_HDR_SIZE		Z_TLSF_ALIGN
+
+/* Blocks smaller than 1 << Z_TLSF_FL_SHIFT all live in first level 0 */
+#define Z_TLSF_FL_SHIFT		(SYS_TLSF_SL_LOG2 + Z_TLSF_ALIGN_LOG2)
+#define Z_TLSF_FL_COUNT \
+	(CONFIG_SYS_TLSF_MAX_BLOCK_LOG2 - Z_TLSF_FL_SHIFT + 1)
+
+/* Largest block (header included) the heap manages */
+#define SYS_TLSF_MAX_BLOCK \
+	(((size_t)1 << CONFIG_SYS_TLSF_MAX_BLOCK_LOG2) - Z_TLSF_ALIGN)
+
+/*
+ * Arena size that is guaranteed to satisfy @a n simultaneous
+ * allocations of @a size bytes: every block pays its header, the
+ * good-fit rounding of the size class search and the alignment,
+ * plus room for the end sentinel and aligning the arena start.
+ * This holds for arenas up to SYS_TLSF_MAX_BLOCK bytes; larger ones
+ * are split into independent chunks and may lose some space at the
+ * chunk boundaries.
+ */
+#define SYS_TLSF_ARENA_SIZE(size, n)					\
+	((n) * ((size) + (size) / SYS_TLSF_SL_COUNT +			\
+		Z_TLSF_HDR_SIZE + Z_TLSF_ALIGN) + 2 * Z_TLSF_ALIGN)
+
+struct z_tlsf_block;
+
+struct sys_tlsf {
+	u32_t fl_bitmap;
+	u8_t sl_bitmap[Z_TLSF_FL_COUNT];
+	struct z_tlsf_block *free[Z_TLSF_FL_COUNT][SYS_TLSF_SL_COUNT];
+};
+
+/**
+ * @brief Initialize a TLSF heap
+ *
+ * Hands the memory region to the heap.  Regions larger than
+ * SYS_TLSF_MAX_BLOCK are carved into several maximum-sized free blocks,
+ * so a single allocation can never exceed that size.
+ *
+ * @param h Heap to initialize
+ * @param mem Start of the memory region
+ * @param bytes Size of the memory region
+ */
+void sys_tlsf_init(struct sys_tlsf *h, void *mem, size_t bytes);
+
+/**
+ * @brief Allocate memory from a TLSF heap
+ *
+ * @param h Heap to allocate from
+ * @param bytes Requested size
+ * @return Pointer aligned to 2 * sizeof(void *), or NULL if no
+ *         sufficiently large free block exists
+ */
+void *sys_tlsf_alloc(struct sys_tlsf *h, size_t bytes);
+
+/**
+ * @brief Free memory allocated with sys_tlsf_alloc()
+ *
+ * The block is coalesced with its free physical neighbors.  It is safe
+ * to pass NULL, in which case this is a no-op.
+ *
+ * @param h Heap the memory was allocated from
+ * @param ptr Memory to free
+ */
+void sys_tlsf_free(struct sys_tlsf *h, void *ptr);
+
+/**
+ * @brief Usable size of an allocated block
+ *
+ * @param ptr Memory returned by sys_tlsf_alloc()
+ * @return Number of bytes usable at @a ptr, at least the requested size
+ */
+size_t sys_tlsf_usable_size(void *ptr);
+
+#endif /* CONFIG_SYS_TLSF */
+
+#endif /* ZEPHYR_INCLUDE_MISC_TLSF_H_ */
@@ -44,16 +44,28 @@ void z_priq_rb_add(struct _priq_rb *pq, struct k_thread *thread);
 void z_priq_rb_remove(struct _priq_rb *pq, struct k_thread *thread);
 struct k_thread *z_priq_rb_best(struct _priq_rb *pq);
 
-/* Traditional/textbook "multi-queue" structure.  Separate lists for a
- * small number (max 32 here) of fixed priorities.  This corresponds
- * to the original Zephyr scheduler.  RAM requirements are
- * comparatively high, but performance is very fast.  Won't work with
- * features like deadline scheduling which need large priority spaces
- * to represet their requirements.
+/* Traditional/textbook "multi-queue" structure.  Separate lists for
+ * each of the configured priorities, with a bitmap of the non-empty
+ * ones so that the best thread is found in constant time.  When more
+ * than 32 priorities are configured, a second-level word records
+ * which bitmap words are non-zero.  Within a priority, threads are
+ * FIFO ordered, or sorted by deadline with CONFIG_SCHED_DEADLINE.
+ * RAM requirements are comparatively high (a list head per
+ * priority), but performance is very fast.
  */
+#define PRIQ_BITMAP_SIZE (CONFIG_NUM_COOP_PRIORITIES +	\
+			  CONFIG_NUM_PREEMPT_PRIORITIES + 1)
+#define PRIQ_BITMAP_WORDS ((PRIQ_BITMAP_SIZE + 31) >> 5)
+
 struct _priq_mq {
-	sys_dlist_t queues[32];
-	unsigned int bitmask; /* bit 1<<i set if queues[i] is non-empty */
+	sys_dlist_t queues[PRIQ_BITMAP_SIZE];
+
+	/* bit i%32 of bitmask[i/32] set if queues[i] is non-empty */
+	unsigned int bitmask[PRIQ_BITMAP_WORDS];
+#if PRIQ_BITMAP_WORDS > 1
+	/* bit w set if bitmask[w] is non-zero */
+	unsigned int words;
+#endif
 };
 
 void z_priq_mq_add(struct _priq_mq *pq, struct k_thread *thread);
@@ -7,6 +7,7 @@
 #define ZEPHYR_INCLUDE_SPINLOCK_H_
 
 #include <atomic.h>
+#include <zephyr/types.h>
 
 /* These stubs aren't provided by the mocking framework, and I can't
  * find a proper place to put them as mocking seems not to have a
@@ -48,10 +49,42 @@ struct k_spinlock_key {
 
 typedef struct k_spinlock_key k_spinlock_key_t;
 
+#ifdef CONFIG_SPINLOCK_STATS
+/* Contention statistics, see k_spin_stats_get() */
+struct k_spinlock_stats {
+	/* Number of times the lock was taken */
+	u32_t acquired;
+	/* Acquisitions that found the lock held and had to spin */
+	u32_t contended;
+	/* Total and worst-case spin loop iterations of an acquisition */
+	u32_t spins;
+	u32_t max_spins;
+	/* Longest time the lock was held, in hardware cycles */
+	u32_t max_hold;
+};
+#endif
+
 struct k_spinlock {
 #ifdef CONFIG_SMP
+#if defined(CONFIG_SPINLOCK_TICKET)
+	/* Next ticket to hand out and ticket currently being served */
+	atomic_t tail;
+	atomic_t owner;
+#elif defined(CONFIG_SPINLOCK_MCS)
+	/* Last queued node (index + 1, zero when free), and the node of
+	 * the current holder, which hands the lock to its successor.
+	 */
+	atomic_t tail;
+	int node;
+#else
 	atomic_t locked;
 #endif
+#endif
+
+#ifdef CONFIG_SPINLOCK_STATS
+	struct k_spinlock_stats stats;
+	u32_t hold_start;
+#endif
 
 #ifdef SPIN_VALIDATE
 	/* Stores the thread that holds the lock with the locking CPU
@@ -61,6 +94,74 @@ struct k_spinlock {
 #endif
 };
 
+#ifdef CONFIG_SPINLOCK_MCS
+u32_t z_spin_lock_mcs(struct k_spinlock *l);
+void z_spin_unlock_mcs(struct k_spinlock *l);
+#endif
+
+#ifdef CONFIG_SPINLOCK_STATS
+void z_spin_stats_acquired(struct k_spinlock *l, u32_t spins);
+void z_spin_stats_released(struct k_spinlock *l);
+
+/**
+ * @brief Read the contention statistics of a spinlock
+ *
+ * The counters are updated by the lock holder and read here without
+ * taking the lock, so a snapshot taken under contention may mix
+ * values from neighbouring acquisitions.
+ *
+ * @param l Spinlock
+ * @param stats Filled with the statistics gathered since the lock
+ *        was initialized or last reset
+ */
+void k_spin_stats_get(struct k_spinlock *l, struct k_spinlock_stats *stats);
+
+/**
+ * @brief Reset the contention statistics of a spinlock
+ *
+ * @param l Spinlock
+ */
+void k_spin_stats_reset(struct k_spinlock *l);
+#endif
+
+#ifdef CONFIG_SMP
+/* Internal: true if some CPU holds the lock */
+static ALWAYS_INLINE bool z_spin_is_locked(struct k_spinlock *l)
+{
+#if defined(CONFIG_SPINLOCK_TICKET)
+	return atomic_get(&l->tail) != atomic_get(&l->owner);
+#elif defined(CONFIG_SPINLOCK_MCS)
+	return atomic_get(&l->tail) != 0;
+#else
+	return atomic_get(&l->locked) != 0;
+#endif
+}
+
+/* Internal: drop the lock word, must be called by the holder */
+static ALWAYS_INLINE void z_spin_release(struct k_spinlock *l)
+{
+#ifdef CONFIG_SPINLOCK_STATS
+	z_spin_stats_released(l);
+#endif
+
+#if defined(CONFIG_SPINLOCK_TICKET)
+	/* Only the holder ever advances the owner field */
+	(void)atomic_inc(&l->owner);
+#elif defined(CONFIG_SPINLOCK_MCS)
+	z_spin_unlock_mcs(l);
+#else
+	/* Strictly we don't need atomic_clear() here (which is an
+	 * exchange operation that returns the old value).  We are always
+	 * setting a zero and (because we hold the lock) know the existing
+	 * state won't change due to a race.  But some architectures need
+	 * a memory barrier when used like this, and we don't have a
+	 * Zephyr framework for that.
+	 */
+	atomic_clear(&l->locked);
+#endif
+}
+#endif
+
 static ALWAYS_INLINE k_spinlock_key_t k_spin_lock(struct k_spinlock *l)
 {
 	ARG_UNUSED(l);
@@ -77,10 +178,29 @@ static ALWAYS_INLINE k_spinlock_key_t k_spin_lock(struct k_spinlock *l)
 #endif
 
 #ifdef CONFIG_SMP
+	u32_t spins = 0U;
+
+#if defined(CONFIG_SPINLOCK_TICKET)
+	atomic_val_t ticket = atomic_inc(&l->tail);
+
+	while (atomic_get(&l->owner) != ticket) {
+		spins++;
+	}
+#elif defined(CONFIG_SPINLOCK_MCS)
+	spins = z_spin_lock_mcs(l);
+#else
 	while (!atomic_cas(&l->locked, 0, 1)) {
+		spins++;
 	}
 #endif
 
+#ifdef CONFIG_SPINLOCK_STATS
+	z_spin_stats_acquired(l, spins);
+#else
+	ARG_UNUSED(spins);
+#endif
+#endif
+
 	return k;
 }
 
@@ -93,14 +213,7 @@ static ALWAYS_INLINE void k_spin_unlock(struct k_spinlock *l,
 #endif
 
 #ifdef CONFIG_SMP
-	/* Strictly we don't need atomic_clear() here (which is an
-	 * exchange operation that returns the old value).  We are always
-	 * setting a zero and (because we hold the lock) know the existing
-	 * state won't change due to a race.  But some architectures need
-	 * a memory barrier when used like this, and we don't have a
-	 * Zephyr framework for that.
-	 */
-	atomic_clear(&l->locked);
+	z_spin_release(l);
 #endif
 	z_arch_irq_unlock(key.key);
 }
@@ -115,7 +228,7 @@ static ALWAYS_INLINE void k_spin_release(struct k_spinlock *l)
 	__ASSERT(z_spin_unlock_valid(l), "Not my spinlock!");
 #endif
 #ifdef CONFIG_SMP
-	atomic_clear(&l->locked);
+	z_spin_release(l);
 #endif
 }
 
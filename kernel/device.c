@@ -7,6 +7,7 @@
 #include <errno.h>
 #include <string.h>
 #include <device.h>
+#include <init.h>
 #include <misc/util.h>
 #include <atomic.h>
 #include <syscall_handler.h>
@@ -25,6 +26,282 @@ extern u32_t __device_busy_end[];
 #define DEVICE_BUSY_SIZE (__device_busy_end - __device_busy_start)
 #endif
 
+#ifdef CONFIG_DEVICE_INIT_TIMING
+extern u32_t __device_init_cycles_start[];
+
+static u32_t level_cycles[_SYS_INIT_LEVEL_APPLICATION + 1];
+
+u32_t device_init_cycles_get(struct device *dev)
+{
+	return __device_init_cycles_start[dev - __device_init_start];
+}
+
+u32_t device_init_level_cycles_get(s32_t level)
+{
+	return level_cycles[level];
+}
+#endif
+
+static void device_init(struct device *info)
+{
+	struct device_config *device_conf = info->config;
+	int retval;
+#ifdef CONFIG_DEVICE_INIT_TIMING
+	u32_t start = k_cycle_get_32();
+#endif
+
+	retval = device_conf->init(info);
+#ifdef CONFIG_DEVICE_INIT_TIMING
+	__device_init_cycles_start[info - __device_init_start] =
+		k_cycle_get_32() - start;
+#endif
+	if (retval != 0) {
+		/* Initialization failed. Clear the API struct so that
+		 * device_get_binding() will not succeed for it.
+		 */
+		info->driver_api = NULL;
+	} else {
+		z_object_init(info);
+	}
+}
+
+#ifdef CONFIG_DEVICE_INIT_PARALLEL
+extern struct device_init_async _device_init_async_list_start[];
+extern struct device_init_async _device_init_async_list_end[];
+
+static K_THREAD_STACK_ARRAY_DEFINE(init_stacks,
+				   CONFIG_DEVICE_INIT_PARALLEL_THREADS,
+				   CONFIG_DEVICE_INIT_PARALLEL_STACK_SIZE);
+static struct k_thread init_threads[CONFIG_DEVICE_INIT_PARALLEL_THREADS];
+static bool init_threads_started;
+
+static K_FIFO_DEFINE(init_fifo);
+
+/* Given each time a worker finishes a device.  Only the thread running
+ * z_sys_device_do_config_level() waits on it.
+ */
+static K_SEM_DEFINE(init_progress, 0, 1);
+static atomic_t init_pending;
+
+static void init_worker(void *p1, void *p2, void *p3)
+{
+	struct device_init_async *async;
+
+	ARG_UNUSED(p1);
+	ARG_UNUSED(p2);
+	ARG_UNUSED(p3);
+
+	while (true) {
+		async = k_fifo_get(&init_fifo, K_FOREVER);
+
+		device_init(async->dev);
+
+		atomic_set(&async->done, 1);
+		atomic_dec(&init_pending);
+		k_sem_give(&init_progress);
+	}
+}
+
+static void init_threads_start(void)
+{
+	int prio = k_thread_priority_get(k_current_get());
+
+	for (int i = 0; i < CONFIG_DEVICE_INIT_PARALLEL_THREADS; i++) {
+		k_thread_create(&init_threads[i], init_stacks[i],
+				K_THREAD_STACK_SIZEOF(init_stacks[i]),
+				init_worker, NULL, NULL, NULL, prio, 0, 0);
+		k_thread_name_set(&init_threads[i], "device_init");
+	}
+
+	init_threads_started = true;
+}
+
+static void init_threads_stop(void)
+{
+	for (int i = 0; i < CONFIG_DEVICE_INIT_PARALLEL_THREADS; i++) {
+		k_thread_abort(&init_threads[i]);
+	}
+
+	init_threads_started = false;
+}
+
+static struct device_init_async *init_async_find(struct device *info)
+{
+	struct device_init_async *async;
+
+	for (async = _device_init_async_list_start;
+	     async < _device_init_async_list_end; async++) {
+		if (async->dev == info) {
+			return async;
+		}
+	}
+
+	return NULL;
+}
+
+/* Wait for all devices handed to the workers to be initialized */
+static void init_barrier(void)
+{
+	while (atomic_get(&init_pending) != 0) {
+		k_sem_take(&init_progress, K_FOREVER);
+	}
+}
+
+/* Wait for a dependency of @a info, which has to be initialized earlier */
+static void init_dep_wait(struct device *info, const char *name)
+{
+	struct device_init_async *async;
+	struct device *dep;
+
+	for (dep = __device_init_start; dep < info; dep++) {
+		if (strcmp(name, dep->config->name) == 0) {
+			break;
+		}
+	}
+
+	__ASSERT(dep < info, "%s: dependency %s not initialized before it",
+		 info->config->name, name);
+
+	async = (dep < info) ? init_async_find(dep) : NULL;
+	if (async == NULL) {
+		/* Initialized in order, before the last barrier */
+		return;
+	}
+
+	while (atomic_get(&async->done) == 0) {
+		k_sem_take(&init_progress, K_FOREVER);
+	}
+}
+
+/* Hand a device marked with DEVICE_INIT_ASYNC() to the workers */
+static bool init_async_start(struct device *info)
+{
+	struct device_init_async *async = init_async_find(info);
+
+	if (async == NULL) {
+		return false;
+	}
+
+	if (!init_threads_started) {
+		init_threads_start();
+	}
+
+	for (int i = 0; i < async->num_deps; i++) {
+		init_dep_wait(info, async->deps[i]);
+	}
+
+	atomic_set(&async->done, 0);
+	atomic_inc(&init_pending);
+	k_fifo_put(&init_fifo, async);
+
+	return true;
+}
+#endif /* CONFIG_DEVICE_INIT_PARALLEL */
+
+#ifdef CONFIG_DEVICE_NAME_INDEX
+#define INDEX_SIZE CONFIG_DEVICE_NAME_INDEX_SIZE
+#define INDEX_MASK (INDEX_SIZE - 1)
+#define INDEX_EMPTY 0xffff
+
+BUILD_ASSERT_MSG((INDEX_SIZE & INDEX_MASK) == 0,
+		 "CONFIG_DEVICE_NAME_INDEX_SIZE must be a power of two");
+
+/* Open addressing hash tables of device indexes, keyed by the address
+ * of the device name and by the name itself.  Devices are inserted in
+ * link order and collisions are resolved by linear probing, so the
+ * first match found by a probe is also the one a scan would find.
+ */
+static u16_t index_by_ptr[INDEX_SIZE];
+static u16_t index_by_name[INDEX_SIZE];
+static bool index_ready;
+
+static u32_t hash_ptr(const char *name)
+{
+	u32_t h = (u32_t)(uintptr_t)name;
+
+	/* Fibonacci hashing: the low bits of string addresses are
+	 * poorly distributed
+	 */
+	return (h * 2654435769U) >> 16;
+}
+
+/* FNV-1a */
+static u32_t hash_name(const char *name)
+{
+	u32_t h = 2166136261U;
+
+	while (*name != '\0') {
+		h = (h ^ (u8_t)*name++) * 16777619U;
+	}
+
+	return h;
+}
+
+static void index_insert(u16_t *table, u32_t hash, u16_t dev)
+{
+	u32_t i = hash & INDEX_MASK;
+
+	while (table[i] != INDEX_EMPTY) {
+		i = (i + 1) & INDEX_MASK;
+	}
+	table[i] = dev;
+}
+
+static void device_index_build(void)
+{
+	size_t count = __device_init_end - __device_init_start;
+
+	/* Keep at least one empty slot so that probes terminate */
+	if (count >= INDEX_SIZE) {
+		return;
+	}
+
+	(void)memset(index_by_ptr, 0xff, sizeof(index_by_ptr));
+	(void)memset(index_by_name, 0xff, sizeof(index_by_name));
+
+	for (u16_t d = 0; d < count; d++) {
+		const char *name = __device_init_start[d].config->name;
+
+		index_insert(index_by_ptr, hash_ptr(name), d);
+		index_insert(index_by_name, hash_name(name), d);
+	}
+
+	index_ready = true;
+}
+
+static struct device *index_find_ptr(const char *name)
+{
+	u32_t i = hash_ptr(name) & INDEX_MASK;
+	struct device *info;
+
+	for (; index_by_ptr[i] != INDEX_EMPTY; i = (i + 1) & INDEX_MASK) {
+		info = &__device_init_start[index_by_ptr[i]];
+		if ((info->driver_api != NULL) &&
+		    (info->config->name == name)) {
+			return info;
+		}
+	}
+
+	return NULL;
+}
+
+static struct device *index_find_name(const char *name)
+{
+	u32_t i = hash_name(name) & INDEX_MASK;
+	struct device *info;
+
+	for (; index_by_name[i] != INDEX_EMPTY; i = (i + 1) & INDEX_MASK) {
+		info = &__device_init_start[index_by_name[i]];
+		if ((info->driver_api != NULL) &&
+		    (strcmp(name, info->config->name) == 0)) {
+			return info;
+		}
+	}
+
+	return NULL;
+}
+#endif /* CONFIG_DEVICE_NAME_INDEX */
+
 /**
  * @brief Execute all the device initialization functions at a given level
  *
@@ -32,7 +309,9 @@ extern u32_t __device_busy_end[];
  * created by the DEVICE_INIT() macro using the specified level.
  * The linker script places the device objects in memory in the order
  * they need to be invoked, with symbols indicating where one level leaves
- * off and the next one begins.
+ * off and the next one begins.  With CONFIG_DEVICE_INIT_PARALLEL, devices
+ * marked with DEVICE_INIT_ASYNC() are handed to worker threads instead,
+ * see DEVICE_INIT_ASYNC() for the ordering rules.
  *
  * @param level init level to run.
  */
@@ -48,27 +327,53 @@ void z_sys_device_do_config_level(s32_t level)
 		__device_init_end,
 	};
 
+#ifdef CONFIG_DEVICE_NAME_INDEX
+	if (level == _SYS_INIT_LEVEL_PRE_KERNEL_1) {
+		device_index_build();
+	}
+#endif
+
+#ifdef CONFIG_DEVICE_INIT_TIMING
+	u32_t start = k_cycle_get_32();
+#endif
+
 	for (info = config_levels[level]; info < config_levels[level+1];
 								info++) {
-		int retval;
-		struct device_config *device_conf = info->config;
-
-		retval = device_conf->init(info);
-		if (retval != 0) {
-			/* Initialization failed. Clear the API struct so that
-			 * device_get_binding() will not succeed for it.
-			 */
-			info->driver_api = NULL;
-		} else {
-			z_object_init(info);
+#ifdef CONFIG_DEVICE_INIT_PARALLEL
+		/* No threads before POST_KERNEL */
+		if (level >= _SYS_INIT_LEVEL_POST_KERNEL &&
+		    init_async_start(info)) {
+			continue;
 		}
+
+		init_barrier();
+#endif
+		device_init(info);
 	}
+
+#ifdef CONFIG_DEVICE_INIT_PARALLEL
+	init_barrier();
+	if (level == _SYS_INIT_LEVEL_APPLICATION && init_threads_started) {
+		init_threads_stop();
+	}
+#endif
+#ifdef CONFIG_DEVICE_INIT_TIMING
+	level_cycles[level] = k_cycle_get_32() - start;
+#endif
 }
 
 struct device *z_impl_device_get_binding(const char *name)
 {
 	struct device *info;
 
+#ifdef CONFIG_DEVICE_NAME_INDEX
+	if (index_ready) {
+		info = index_find_ptr(name);
+
+		return (info != NULL) ? info : index_find_name(name);
+	}
+#endif
+
 	/* Split the search into two loops: in the common scenario, where
 	 * device names are stored in ROM (and are referenced by the user
 	 * with CONFIG_* macros), only cheap pointer comparisons will be
@@ -99,6 +404,19 @@ Z_SYSCALL_HANDLER(device_get_binding, name)
 {
 	char name_copy[Z_DEVICE_MAX_NAME_LEN];
 
+#ifdef CONFIG_DEVICE_NAME_INDEX
+	/* A device's own name string is matched by address alone,
+	 * without reading user memory
+	 */
+	if (index_ready) {
+		struct device *info = index_find_ptr((const char *)name);
+
+		if (info != NULL) {
+			return (u32_t)info;
+		}
+	}
+#endif
+
 	if (z_user_string_copy(name_copy, (char *)name, sizeof(name_copy))
 	    != 0) {
 		return 0;
@@ -29,6 +29,14 @@ static inline void z_init_timeout(struct _timeout *t, _timeout_func_t fn)
 
 void z_add_timeout(struct _timeout *to, _timeout_func_t fn, s32_t ticks);
 
+#ifdef CONFIG_TIMEOUT_SLACK
+/* Like z_add_timeout(), but the timeout may expire up to slack ticks
+ * late, aligned so that timeouts with similar slack share a tick.
+ */
+void z_add_timeout_slack(struct _timeout *to, _timeout_func_t fn,
+			 s32_t ticks, s32_t slack);
+#endif
+
 int z_abort_timeout(struct _timeout *to);
 
 static inline bool z_is_inactive_timeout(struct _timeout *t)
@@ -23,6 +23,140 @@ static struct k_spinlock lock;
 struct k_mem_slab *_trace_list_k_mem_slab;
 #endif	/* CONFIG_OBJECT_TRACING */
 
+#ifdef CONFIG_MEM_SLAB_CPU_CACHE
+#define MAG_SIZE CONFIG_MEM_SLAB_CPU_CACHE_SIZE
+#define MAG_BATCH (MAG_SIZE / 2)
+
+/* num_used is also updated under the per-CPU magazine locks */
+static inline void used_add(struct k_mem_slab *slab, int delta)
+{
+	(void)atomic_add((atomic_t *)&slab->num_used, delta);
+}
+
+/*
+ * Magazine of the CPU we're running on.  Migrating right after the
+ * lookup is harmless: the magazine has its own lock, we'd merely use
+ * another CPU's cache for one operation.
+ */
+static inline struct z_mem_slab_mag *cpu_mag(struct k_mem_slab *slab)
+{
+	return &slab->cache->mags[_current_cpu->id];
+}
+
+/*
+ * Lock ordering: the global slab lock is always taken before a
+ * magazine lock, never the other way around.
+ */
+
+static bool cache_alloc(struct k_mem_slab *slab, void **mem)
+{
+	struct z_mem_slab_mag *mag = cpu_mag(slab);
+	k_spinlock_key_t key = k_spin_lock(&mag->lock);
+	k_spinlock_key_t mkey;
+	bool ret = false;
+
+	if (mag->count != 0U) {
+		*mem = mag->blocks[--mag->count];
+		used_add(slab, 1);
+		k_spin_unlock(&mag->lock, key);
+		return true;
+	}
+	k_spin_unlock(&mag->lock, key);
+
+	/* Empty: refill half a magazine from the shared free list */
+	key = k_spin_lock(&lock);
+	mkey = k_spin_lock(&mag->lock);
+
+	while (mag->count < MAG_BATCH && slab->free_list != NULL) {
+		mag->blocks[mag->count++] = slab->free_list;
+		slab->free_list = *(char **)(slab->free_list);
+	}
+
+	if (mag->count != 0U) {
+		*mem = mag->blocks[--mag->count];
+		used_add(slab, 1);
+		ret = true;
+	}
+
+	k_spin_unlock(&mag->lock, mkey);
+	k_spin_unlock(&lock, key);
+
+	return ret;
+}
+
+static bool cache_free(struct k_mem_slab *slab, void **mem)
+{
+	struct z_mem_slab_mag *mag = cpu_mag(slab);
+	k_spinlock_key_t key = k_spin_lock(&mag->lock);
+	k_spinlock_key_t mkey;
+	bool ret = false;
+
+	/*
+	 * With an allocator (possibly) pended on the slab the block has
+	 * to go through the regular path so it can be handed over.  The
+	 * waiter count is raised before the magazines are reclaimed, so
+	 * reading it under the magazine lock can't miss a waiter that
+	 * would also miss this block.
+	 */
+	if (atomic_get(&slab->cache->waiters) != 0) {
+		k_spin_unlock(&mag->lock, key);
+		return false;
+	}
+
+	if (mag->count < MAG_SIZE) {
+		mag->blocks[mag->count++] = *mem;
+		used_add(slab, -1);
+		k_spin_unlock(&mag->lock, key);
+		return true;
+	}
+	k_spin_unlock(&mag->lock, key);
+
+	/* Full: drain half a magazine back to the shared free list */
+	key = k_spin_lock(&lock);
+	mkey = k_spin_lock(&mag->lock);
+
+	if (atomic_get(&slab->cache->waiters) == 0) {
+		while (mag->count > MAG_SIZE - MAG_BATCH) {
+			char *block = mag->blocks[--mag->count];
+
+			*(char **)block = slab->free_list;
+			slab->free_list = block;
+		}
+		mag->blocks[mag->count++] = *mem;
+		used_add(slab, -1);
+		ret = true;
+	}
+
+	k_spin_unlock(&mag->lock, mkey);
+	k_spin_unlock(&lock, key);
+
+	return ret;
+}
+
+/* Move every cached block back to the shared free list, lock held */
+static void cache_reclaim(struct k_mem_slab *slab)
+{
+	for (int i = 0; i < CONFIG_MP_NUM_CPUS; i++) {
+		struct z_mem_slab_mag *mag = &slab->cache->mags[i];
+		k_spinlock_key_t key = k_spin_lock(&mag->lock);
+
+		while (mag->count != 0U) {
+			char *block = mag->blocks[--mag->count];
+
+			*(char **)block = slab->free_list;
+			slab->free_list = block;
+		}
+
+		k_spin_unlock(&mag->lock, key);
+	}
+}
+#else
+static inline void used_add(struct k_mem_slab *slab, int delta)
+{
+	slab->num_used += delta;
+}
+#endif	/* CONFIG_MEM_SLAB_CPU_CACHE */
+
 /**
  * @brief Initialize kernel memory slab subsystem.
  *
@@ -83,6 +217,9 @@ void k_mem_slab_init(struct k_mem_slab *slab, void *buffer,
 	slab->block_size = block_size;
 	slab->buffer = buffer;
 	slab->num_used = 0;
+#ifdef CONFIG_MEM_SLAB_CPU_CACHE
+	slab->cache = NULL;
+#endif
 	create_free_list(slab);
 	z_waitq_init(&slab->wait_q);
 	SYS_TRACING_OBJ_INIT(k_mem_slab, slab);
@@ -92,18 +229,43 @@ void k_mem_slab_init(struct k_mem_slab *slab, void *buffer,
 
 int k_mem_slab_alloc(struct k_mem_slab *slab, void **mem, s32_t timeout)
 {
-	k_spinlock_key_t key = k_spin_lock(&lock);
+	k_spinlock_key_t key;
 	int result;
+#ifdef CONFIG_MEM_SLAB_CPU_CACHE
+	bool waiting = false;
+#endif
 
 	/* block size must be word aligned */
 	__ASSERT((slab->block_size & (sizeof(void *) - 1)) == 0,
 		 "block size not word aligned");
 
+#ifdef CONFIG_MEM_SLAB_CPU_CACHE
+	if (slab->cache != NULL && cache_alloc(slab, mem)) {
+		return 0;
+	}
+#endif
+
+	key = k_spin_lock(&lock);
+
+#ifdef CONFIG_MEM_SLAB_CPU_CACHE
+	if (slab->free_list == NULL && slab->cache != NULL) {
+		/*
+		 * Free blocks may be parked in other CPUs' magazines.
+		 * Announce ourselves first so that concurrent frees stop
+		 * caching and come to the wait queue instead, then pull
+		 * everything back to the shared free list.
+		 */
+		(void)atomic_inc(&slab->cache->waiters);
+		waiting = true;
+		cache_reclaim(slab);
+	}
+#endif
+
 	if (slab->free_list != NULL) {
 		/* take a free block */
 		*mem = slab->free_list;
 		slab->free_list = *(char **)(slab->free_list);
-		slab->num_used++;
+		used_add(slab, 1);
 		result = 0;
 	} else if (timeout == K_NO_WAIT) {
 		/* don't wait for a free block to become available */
@@ -115,9 +277,19 @@ int k_mem_slab_alloc(struct k_mem_slab *slab, void **mem, s32_t timeout)
 		if (result == 0) {
 			*mem = _current->base.swap_data;
 		}
+#ifdef CONFIG_MEM_SLAB_CPU_CACHE
+		if (waiting) {
+			(void)atomic_dec(&slab->cache->waiters);
+		}
+#endif
 		return result;
 	}
 
+#ifdef CONFIG_MEM_SLAB_CPU_CACHE
+	if (waiting) {
+		(void)atomic_dec(&slab->cache->waiters);
+	}
+#endif
 	k_spin_unlock(&lock, key);
 
 	return result;
@@ -125,8 +297,17 @@ int k_mem_slab_alloc(struct k_mem_slab *slab, void **mem, s32_t timeout)
 
 void k_mem_slab_free(struct k_mem_slab *slab, void **mem)
 {
-	k_spinlock_key_t key = k_spin_lock(&lock);
-	struct k_thread *pending_thread = z_unpend_first_thread(&slab->wait_q);
+	k_spinlock_key_t key;
+	struct k_thread *pending_thread;
+
+#ifdef CONFIG_MEM_SLAB_CPU_CACHE
+	if (slab->cache != NULL && cache_free(slab, mem)) {
+		return;
+	}
+#endif
+
+	key = k_spin_lock(&lock);
+	pending_thread = z_unpend_first_thread(&slab->wait_q);
 
 	if (pending_thread != NULL) {
 		z_set_thread_return_value_with_data(pending_thread, 0, *mem);
@@ -135,7 +316,7 @@ void k_mem_slab_free(struct k_mem_slab *slab, void **mem)
 	} else {
 		**(char ***)mem = slab->free_list;
 		slab->free_list = *(char **)mem;
-		slab->num_used--;
+		used_add(slab, -1);
 		k_spin_unlock(&lock, key);
 	}
 }
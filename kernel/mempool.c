@@ -31,7 +31,15 @@ static int pool_id(struct k_mem_pool *pool)
 static void k_mem_pool_init(struct k_mem_pool *p)
 {
 	z_waitq_init(&p->wait_q);
+#ifdef CONFIG_MEM_POOL_TLSF
+	size_t bytes = SYS_TLSF_ARENA_SIZE(p->base.max_sz, p->base.n_max);
+
+	/* Block IDs store the offset in 4-byte units in 20 bits */
+	__ASSERT(bytes <= (4 << 20), "TLSF memory pool too large");
+	sys_tlsf_init(&p->tlsf, p->base.buf, bytes);
+#else
 	z_sys_mem_pool_base_init(&p->base);
+#endif
 }
 
 int init_static_pools(struct device *unused)
@@ -48,6 +56,77 @@ int init_static_pools(struct device *unused)
 
 SYS_INIT(init_static_pools, PRE_KERNEL_1, CONFIG_KERNEL_INIT_PRIORITY_OBJECTS);
 
+#ifdef CONFIG_MEM_POOL_TLSF
+/*
+ * TLSF allocations and frees are short and bounded, so they simply run
+ * under the spinlock.  The block ID records the block's offset in the
+ * pool buffer; the level is unused.
+ */
+static int pool_alloc(struct k_mem_pool *p, struct k_mem_block *block,
+		      size_t size)
+{
+	k_spinlock_key_t key = k_spin_lock(&lock);
+
+	block->data = sys_tlsf_alloc(&p->tlsf, size);
+
+	k_spin_unlock(&lock, key);
+
+	block->id.pool = pool_id(p);
+	block->id.level = 0;
+	block->id.block = block->data == NULL ? 0 :
+		((u8_t *)block->data - (u8_t *)p->base.buf) / 4;
+
+	return block->data != NULL ? 0 : -ENOMEM;
+}
+
+static void pool_free(struct k_mem_pool *p, struct k_mem_block_id *id)
+{
+	k_spinlock_key_t key = k_spin_lock(&lock);
+
+	sys_tlsf_free(&p->tlsf, (u8_t *)p->base.buf + id->block * 4);
+
+	k_spin_unlock(&lock, key);
+}
+#else
+static int pool_alloc(struct k_mem_pool *p, struct k_mem_block *block,
+		      size_t size)
+{
+	u32_t level_num, block_num;
+	int ret;
+
+	/* There is a "managed race" in alloc that can fail
+	 * (albeit in a well-defined way, see comments there)
+	 * with -EAGAIN when simultaneous allocations happen.
+	 * Retry exactly once before sleeping to resolve it.
+	 * If we're so contended that it fails twice, then we
+	 * clearly want to block.
+	 */
+	for (int i = 0; i < 2; i++) {
+		ret = z_sys_mem_pool_block_alloc(&p->base, size,
+						&level_num, &block_num,
+						&block->data);
+		if (ret != -EAGAIN) {
+			break;
+		}
+	}
+
+	if (ret == -EAGAIN) {
+		ret = -ENOMEM;
+	}
+
+	block->id.pool = pool_id(p);
+	block->id.level = level_num;
+	block->id.block = block_num;
+
+	return ret;
+}
+
+static void pool_free(struct k_mem_pool *p, struct k_mem_block_id *id)
+{
+	z_sys_mem_pool_block_free(&p->base, id->level, id->block);
+}
+#endif
+
 int k_mem_pool_alloc(struct k_mem_pool *p, struct k_mem_block *block,
 		     size_t size, s32_t timeout)
 {
@@ -61,31 +140,7 @@ int k_mem_pool_alloc(struct k_mem_pool *p, struct k_mem_block *block,
 	}
 
 	while (true) {
-		u32_t level_num, block_num;
-
-		/* There is a "managed race" in alloc that can fail
-		 * (albeit in a well-defined way, see comments there)
-		 * with -EAGAIN when simultaneous allocations happen.
-		 * Retry exactly once before sleeping to resolve it.
-		 * If we're so contended that it fails twice, then we
-		 * clearly want to block.
-		 */
-		for (int i = 0; i < 2; i++) {
-			ret = z_sys_mem_pool_block_alloc(&p->base, size,
-							&level_num, &block_num,
-							&block->data);
-			if (ret != -EAGAIN) {
-				break;
-			}
-		}
-
-		if (ret == -EAGAIN) {
-			ret = -ENOMEM;
-		}
-
-		block->id.pool = pool_id(p);
-		block->id.level = level_num;
-		block->id.block = block_num;
+		ret = pool_alloc(p, block, size);
 
 		if (ret == 0 || timeout == K_NO_WAIT ||
 		    ret != -ENOMEM) {
@@ -111,7 +166,7 @@ void k_mem_pool_free_id(struct k_mem_block_id *id)
 	int need_sched = 0;
 	struct k_mem_pool *p = get_pool(id->pool);
 
-	z_sys_mem_pool_block_free(&p->base, id->level, id->block);
+	pool_free(p, id);
 
 	/* Wake up anyone blocked on this pool and let them repeat
 	 * their allocation attempts
@@ -60,6 +60,10 @@ void k_msgq_init(struct k_msgq *q, char *buffer, size_t msg_size,
 	q->used_msgs = 0;
 	q->flags = 0;
 	z_waitq_init(&q->wait_q);
+#ifdef CONFIG_MSGQ_PRIORITY
+	q->urgent_msgs = 0;
+	z_waitq_init(&q->urgent_wait_q);
+#endif
 	q->lock = (struct k_spinlock) {};
 	SYS_TRACING_OBJ_INIT(k_msgq, q);
 
@@ -102,6 +106,9 @@ Z_SYSCALL_HANDLER(k_msgq_alloc_init, q, msg_size, max_msgs)
 void k_msgq_cleanup(struct k_msgq *q)
 {
 	__ASSERT_NO_MSG(!z_waitq_head(&q->wait_q));
+#ifdef CONFIG_MSGQ_PRIORITY
+	__ASSERT_NO_MSG(!z_waitq_head(&q->urgent_wait_q));
+#endif
 
 	if ((q->flags & K_MSGQ_FLAG_ALLOC) != 0) {
 		k_free(q->buffer_start);
@@ -109,35 +116,136 @@ void k_msgq_cleanup(struct k_msgq *q)
 	}
 }
 
+/* Append a message at the tail of the ring buffer */
+static void msgq_push(struct k_msgq *q, void *data)
+{
+	(void)memcpy(q->write_ptr, data, q->msg_size);
+	q->write_ptr += q->msg_size;
+	if (q->write_ptr == q->buffer_end) {
+		q->write_ptr = q->buffer_start;
+	}
+	q->used_msgs++;
+}
 
-int z_impl_k_msgq_put(struct k_msgq *q, void *data, s32_t timeout)
+/* Remove the message at the head of the ring buffer */
+static void msgq_pop(struct k_msgq *q, void *data)
+{
+	(void)memcpy(data, q->read_ptr, q->msg_size);
+	q->read_ptr += q->msg_size;
+	if (q->read_ptr == q->buffer_end) {
+		q->read_ptr = q->buffer_start;
+	}
+	q->used_msgs--;
+#ifdef CONFIG_MSGQ_PRIORITY
+	if (q->urgent_msgs > 0) {
+		q->urgent_msgs--;
+	}
+#endif
+}
+
+#ifdef CONFIG_MSGQ_PRIORITY
+/*
+ * Insert a message behind the urgent messages at the head of the ring
+ * buffer: grow the ring backwards by one slot and slide the queued
+ * urgent messages into it, so urgent messages stay in FIFO order.
+ */
+static void msgq_push_urgent(struct k_msgq *q, void *data)
+{
+	char *dst, *src;
+	u32_t i;
+
+	if (q->read_ptr == q->buffer_start) {
+		q->read_ptr = q->buffer_end;
+	}
+	q->read_ptr -= q->msg_size;
+
+	dst = q->read_ptr;
+	for (i = 0; i < q->urgent_msgs; i++) {
+		src = dst + q->msg_size;
+		if (src == q->buffer_end) {
+			src = q->buffer_start;
+		}
+		(void)memcpy(dst, src, q->msg_size);
+		dst = src;
+	}
+	(void)memcpy(dst, data, q->msg_size);
+
+	q->urgent_msgs++;
+	q->used_msgs++;
+}
+#endif
+
+/*
+ * Give a message directly to the first thread waiting to receive, if
+ * any.  Receivers only wait on an empty queue.
+ */
+static bool msgq_give_to_reader(struct k_msgq *q, void *data)
+{
+	struct k_thread *pending_thread = z_unpend_first_thread(&q->wait_q);
+
+	if (pending_thread == NULL) {
+		return false;
+	}
+
+	(void)memcpy(pending_thread->base.swap_data, data, q->msg_size);
+	z_set_thread_return_value(pending_thread, 0);
+	z_ready_thread(pending_thread);
+
+	return true;
+}
+
+/*
+ * Move the message of the first thread waiting to send, if any, into
+ * the slot that was just freed.  Senders only wait on a full queue;
+ * urgent senders go first.
+ */
+static bool msgq_take_from_writer(struct k_msgq *q)
+{
+	struct k_thread *pending_thread = NULL;
+
+#ifdef CONFIG_MSGQ_PRIORITY
+	pending_thread = z_unpend_first_thread(&q->urgent_wait_q);
+	if (pending_thread != NULL) {
+		msgq_push_urgent(q, pending_thread->base.swap_data);
+	}
+#endif
+	if (pending_thread == NULL) {
+		pending_thread = z_unpend_first_thread(&q->wait_q);
+		if (pending_thread == NULL) {
+			return false;
+		}
+		msgq_push(q, pending_thread->base.swap_data);
+	}
+
+	z_set_thread_return_value(pending_thread, 0);
+	z_ready_thread(pending_thread);
+
+	return true;
+}
+
+static int msgq_put(struct k_msgq *q, void *data, s32_t timeout, bool urgent)
 {
 	__ASSERT(!z_is_in_isr() || timeout == K_NO_WAIT, "");
 
 	k_spinlock_key_t key = k_spin_lock(&q->lock);
-	struct k_thread *pending_thread;
+	_wait_q_t *wait_q = &q->wait_q;
 	int result;
 
 	if (q->used_msgs < q->max_msgs) {
 		/* message queue isn't full */
-		pending_thread = z_unpend_first_thread(&q->wait_q);
-		if (pending_thread != NULL) {
-			/* give message to waiting thread */
-			(void)memcpy(pending_thread->base.swap_data, data,
-			       q->msg_size);
-			/* wake up waiting thread */
-			z_set_thread_return_value(pending_thread, 0);
-			z_ready_thread(pending_thread);
+		if (msgq_give_to_reader(q, data)) {
 			z_reschedule(&q->lock, key);
 			return 0;
-		} else {
-			/* put message in queue */
-			(void)memcpy(q->write_ptr, data, q->msg_size);
-			q->write_ptr += q->msg_size;
-			if (q->write_ptr == q->buffer_end) {
-				q->write_ptr = q->buffer_start;
-			}
-			q->used_msgs++;
+		}
+
+		/* put message in queue */
+#ifdef CONFIG_MSGQ_PRIORITY
+		if (urgent) {
+			msgq_push_urgent(q, data);
+		} else
+#endif
+		{
+			msgq_push(q, data);
 		}
 		result = 0;
 	} else if (timeout == K_NO_WAIT) {
@@ -145,8 +253,13 @@ int z_impl_k_msgq_put(struct k_msgq *q, void *data, s32_t timeout)
 		result = -ENOMSG;
 	} else {
 		/* wait for put message success, failure, or timeout */
+#ifdef CONFIG_MSGQ_PRIORITY
+		if (urgent) {
+			wait_q = &q->urgent_wait_q;
+		}
+#endif
 		_current->base.swap_data = data;
-		return z_pend_curr(&q->lock, key, &q->wait_q, timeout);
+		return z_pend_curr(&q->lock, key, wait_q, timeout);
 	}
 
 	k_spin_unlock(&q->lock, key);
@@ -154,6 +267,11 @@ int z_impl_k_msgq_put(struct k_msgq *q, void *data, s32_t timeout)
 	return result;
 }
 
+int z_impl_k_msgq_put(struct k_msgq *q, void *data, s32_t timeout)
+{
+	return msgq_put(q, data, timeout, false);
+}
+
 #ifdef CONFIG_USERSPACE
 Z_SYSCALL_HANDLER(k_msgq_put, msgq_p, data, timeout)
 {
@@ -190,33 +308,14 @@ int z_impl_k_msgq_get(struct k_msgq *q, void *data, s32_t timeout)
 	__ASSERT(!z_is_in_isr() || timeout == K_NO_WAIT, "");
 
 	k_spinlock_key_t key = k_spin_lock(&q->lock);
-	struct k_thread *pending_thread;
 	int result;
 
 	if (q->used_msgs > 0) {
 		/* take first available message from queue */
-		(void)memcpy(data, q->read_ptr, q->msg_size);
-		q->read_ptr += q->msg_size;
-		if (q->read_ptr == q->buffer_end) {
-			q->read_ptr = q->buffer_start;
-		}
-		q->used_msgs--;
+		msgq_pop(q, data);
 
 		/* handle first thread waiting to write (if any) */
-		pending_thread = z_unpend_first_thread(&q->wait_q);
-		if (pending_thread != NULL) {
-			/* add thread's message to queue */
-			(void)memcpy(q->write_ptr, pending_thread->base.swap_data,
-			       q->msg_size);
-			q->write_ptr += q->msg_size;
-			if (q->write_ptr == q->buffer_end) {
-				q->write_ptr = q->buffer_start;
-			}
-			q->used_msgs++;
-
-			/* wake up waiting thread */
-			z_set_thread_return_value(pending_thread, 0);
-			z_ready_thread(pending_thread);
+		if (msgq_take_from_writer(q)) {
 			z_reschedule(&q->lock, key);
 			return 0;
 		}
@@ -247,6 +346,134 @@ Z_SYSCALL_HANDLER(k_msgq_get, msgq_p, data, timeout)
 }
 #endif
 
+int z_impl_k_msgq_put_many(struct k_msgq *q, void *data, u32_t num,
+			   s32_t timeout)
+{
+	__ASSERT(!z_is_in_isr() || timeout == K_NO_WAIT, "");
+
+	k_spinlock_key_t key = k_spin_lock(&q->lock);
+	char *src = data;
+	bool resched = false;
+	u32_t n = 0U;
+	int result;
+
+	while (n < num && q->used_msgs < q->max_msgs) {
+		if (q->used_msgs == 0U && msgq_give_to_reader(q, src)) {
+			resched = true;
+		} else {
+			msgq_push(q, src);
+		}
+		src += q->msg_size;
+		n++;
+	}
+
+	if (n > 0 || num == 0U) {
+		result = n;
+	} else if (timeout == K_NO_WAIT) {
+		result = -ENOMSG;
+	} else {
+		/* wait for room for the first message, like k_msgq_put() */
+		_current->base.swap_data = data;
+		result = z_pend_curr(&q->lock, key, &q->wait_q, timeout);
+		return (result == 0) ? 1 : result;
+	}
+
+	if (resched) {
+		z_reschedule(&q->lock, key);
+	} else {
+		k_spin_unlock(&q->lock, key);
+	}
+
+	return result;
+}
+
+#ifdef CONFIG_USERSPACE
+Z_SYSCALL_HANDLER(k_msgq_put_many, msgq_p, data, num, timeout)
+{
+	struct k_msgq *q = (struct k_msgq *)msgq_p;
+
+	Z_OOPS(Z_SYSCALL_OBJ(q, K_OBJ_MSGQ));
+	Z_OOPS(Z_SYSCALL_MEMORY_ARRAY_READ(data, num, q->msg_size));
+
+	return z_impl_k_msgq_put_many(q, (void *)data, num, timeout);
+}
+#endif
+
+int z_impl_k_msgq_get_many(struct k_msgq *q, void *data, u32_t num,
+			   s32_t timeout)
+{
+	__ASSERT(!z_is_in_isr() || timeout == K_NO_WAIT, "");
+
+	k_spinlock_key_t key = k_spin_lock(&q->lock);
+	char *dst = data;
+	bool resched = false;
+	u32_t n = 0U;
+	int result;
+
+	while (n < num && q->used_msgs > 0) {
+		bool was_full = (q->used_msgs == q->max_msgs);
+
+		msgq_pop(q, dst);
+		dst += q->msg_size;
+		n++;
+
+		/* a blocked writer keeps its place in FIFO order */
+		if (was_full && msgq_take_from_writer(q)) {
+			resched = true;
+		}
+	}
+
+	if (n > 0 || num == 0U) {
+		result = n;
+	} else if (timeout == K_NO_WAIT) {
+		result = -ENOMSG;
+	} else {
+		/* wait for a single message, like k_msgq_get() */
+		_current->base.swap_data = data;
+		result = z_pend_curr(&q->lock, key, &q->wait_q, timeout);
+		return (result == 0) ? 1 : result;
+	}
+
+	if (resched) {
+		z_reschedule(&q->lock, key);
+	} else {
+		k_spin_unlock(&q->lock, key);
+	}
+
+	return result;
+}
+
+#ifdef CONFIG_USERSPACE
+Z_SYSCALL_HANDLER(k_msgq_get_many, msgq_p, data, num, timeout)
+{
+	struct k_msgq *q = (struct k_msgq *)msgq_p;
+
+	Z_OOPS(Z_SYSCALL_OBJ(q, K_OBJ_MSGQ));
+	Z_OOPS(Z_SYSCALL_MEMORY_ARRAY_WRITE(data, num, q->msg_size));
+
+	return z_impl_k_msgq_get_many(q, (void *)data, num, timeout);
+}
+#endif
+
+#ifdef CONFIG_MSGQ_PRIORITY
+int z_impl_k_msgq_put_urgent(struct k_msgq *q, void *data, s32_t timeout)
+{
+	return msgq_put(q, data, timeout, true);
+}
+
+#ifdef CONFIG_USERSPACE
+Z_SYSCALL_HANDLER(k_msgq_put_urgent, msgq_p, data, timeout)
+{
+	struct k_msgq *q = (struct k_msgq *)msgq_p;
+
+	Z_OOPS(Z_SYSCALL_OBJ(q, K_OBJ_MSGQ));
+	Z_OOPS(Z_SYSCALL_MEMORY_READ(data, q->msg_size));
+
+	return z_impl_k_msgq_put_urgent(q, (void *)data, timeout);
+}
+#endif
+#endif /* CONFIG_MSGQ_PRIORITY */
+
 int z_impl_k_msgq_peek(struct k_msgq *q, void *data)
 {
 	k_spinlock_key_t key = k_spin_lock(&q->lock);
@@ -288,6 +515,14 @@ void z_impl_k_msgq_purge(struct k_msgq *q)
 		z_set_thread_return_value(pending_thread, -ENOMSG);
 		z_ready_thread(pending_thread);
 	}
+#ifdef CONFIG_MSGQ_PRIORITY
+	while ((pending_thread =
+		z_unpend_first_thread(&q->urgent_wait_q)) != NULL) {
+		z_set_thread_return_value(pending_thread, -ENOMSG);
+		z_ready_thread(pending_thread);
+	}
+	q->urgent_msgs = 0;
+#endif
 
 	q->used_msgs = 0;
 	q->read_ptr = q->write_ptr;
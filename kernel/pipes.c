@@ -139,6 +139,8 @@ void k_pipe_init(struct k_pipe *pipe, unsigned char *buffer, size_t size)
 	pipe->bytes_used = 0;
 	pipe->read_index = 0;
 	pipe->write_index = 0;
+	pipe->put_claimed = 0;
+	pipe->get_claimed = 0;
 	pipe->flags = 0;
 	z_waitq_init(&pipe->wait_q.writers);
 	z_waitq_init(&pipe->wait_q.readers);
@@ -441,6 +443,8 @@ int z_pipe_put_internal(struct k_pipe *pipe, struct k_pipe_async *async_desc,
 	ARG_UNUSED(async_desc);
 #endif
 
+	__ASSERT(pipe->put_claimed == 0, "pipe has an outstanding put claim");
+
 	k_spinlock_key_t key = k_spin_lock(&pipe->lock);
 
 	/*
@@ -582,6 +586,7 @@ int z_impl_k_pipe_get(struct k_pipe *pipe, void *data, size_t bytes_to_read,
 
 	__ASSERT(min_xfer <= bytes_to_read, "");
 	__ASSERT(bytes_read != NULL, "");
+	__ASSERT(pipe->get_claimed == 0, "pipe has an outstanding get claim");
 
 	k_spinlock_key_t key = k_spin_lock(&pipe->lock);
 
@@ -781,3 +786,202 @@ void k_pipe_block_put(struct k_pipe *pipe, struct k_mem_block *block,
 				    bytes_to_write, K_FOREVER);
 }
 #endif
+
+/*
+ * Claim/commit API.
+ *
+ * A claim hands out a contiguous span of the pipe's buffer without moving
+ * any index; the commit then advances the index.  A thread waiting for a
+ * claim pends on the regular readers/writers wait queue with an empty
+ * descriptor (zero bytes to transfer), so k_pipe_put()/k_pipe_get() and
+ * the commits wake it up like any other satisfied request once data or
+ * space is available.  This keeps the invariants pipe_xfer_prepare()
+ * relies on: claim writers only wait when the buffer is full, claim
+ * readers only when it is empty.
+ */
+
+static void pipe_claim_wait(struct k_pipe *pipe, k_spinlock_key_t key,
+			    _wait_q_t *wait_q, s32_t timeout)
+{
+	struct k_pipe_desc pipe_desc;
+
+	pipe_desc.buffer = NULL;
+	pipe_desc.bytes_to_xfer = 0;
+
+	_current->base.swap_data = &pipe_desc;
+
+	(void)z_pend_curr(&pipe->lock, key, wait_q, timeout);
+}
+
+static int pipe_claim(struct k_pipe *pipe, void **data, size_t *size,
+		      s32_t timeout, bool put)
+{
+	size_t *claimed = put ? &pipe->put_claimed : &pipe->get_claimed;
+	bool waited = false;
+	s64_t end = 0;
+
+	__ASSERT(pipe->size != 0, "pipe has no buffer");
+
+	if (timeout > 0) {
+		end = z_tick_get() + z_ms_to_ticks(timeout);
+	}
+
+	while (true) {
+		k_spinlock_key_t key = k_spin_lock(&pipe->lock);
+		size_t avail;
+
+		if (*claimed != 0) {
+			k_spin_unlock(&pipe->lock, key);
+			return -EBUSY;
+		}
+
+		if (put) {
+			avail = MIN(pipe->size - pipe->bytes_used,
+				    pipe->size - pipe->write_index);
+		} else {
+			avail = MIN(pipe->bytes_used,
+				    pipe->size - pipe->read_index);
+		}
+
+		if (avail != 0) {
+			avail = MIN(avail, *size);
+			*data = pipe->buffer +
+				(put ? pipe->write_index : pipe->read_index);
+			*claimed = avail;
+			*size = avail;
+			k_spin_unlock(&pipe->lock, key);
+			return 0;
+		}
+
+		if (timeout == K_NO_WAIT) {
+			k_spin_unlock(&pipe->lock, key);
+			return waited ? -EAGAIN : -EIO;
+		}
+
+		/*
+		 * Like other pipe waiters we're readied without a return
+		 * value, so simply look again after waking up.
+		 */
+		pipe_claim_wait(pipe, key, put ? &pipe->wait_q.writers :
+				&pipe->wait_q.readers, timeout);
+		waited = true;
+
+		if (timeout != K_FOREVER) {
+			s64_t left = end - z_tick_get();
+
+			timeout = left > 0 ? (s32_t)__ticks_to_ms(left) :
+				  K_NO_WAIT;
+		}
+	}
+}
+
+/*
+ * Hand the data (or space) that a commit made available to threads
+ * waiting on @a wait_q, oldest first.  Satisfied requests, including
+ * waiting claims, are moved to @a xfer_list to be readied.
+ */
+static void pipe_claim_serve(struct k_pipe *pipe, _wait_q_t *wait_q,
+			     sys_dlist_t *xfer_list, bool readers)
+{
+	struct k_thread *thread;
+	struct k_pipe_desc *desc;
+
+	while ((readers ? pipe->bytes_used != 0 :
+		pipe->bytes_used != pipe->size) &&
+	       (thread = z_waitq_head(wait_q)) != NULL) {
+		size_t bytes_copied;
+
+		desc = (struct k_pipe_desc *)thread->base.swap_data;
+
+		if (readers) {
+			bytes_copied = pipe_buffer_get(pipe, desc->buffer,
+						       desc->bytes_to_xfer);
+		} else {
+			bytes_copied = pipe_buffer_put(pipe, desc->buffer,
+						       desc->bytes_to_xfer);
+		}
+
+		desc->buffer        += bytes_copied;
+		desc->bytes_to_xfer -= bytes_copied;
+
+		if (desc->bytes_to_xfer != 0) {
+			/* Partially served; stays pended */
+			break;
+		}
+
+		z_unpend_thread(thread);
+		sys_dlist_append(xfer_list, &thread->base.qnode_dlist);
+	}
+}
+
+static int pipe_commit(struct k_pipe *pipe, size_t size, bool put)
+{
+	k_spinlock_key_t key = k_spin_lock(&pipe->lock);
+	sys_dlist_t xfer_list;
+	struct k_thread *thread;
+
+	if (size > (put ? pipe->put_claimed : pipe->get_claimed)) {
+		k_spin_unlock(&pipe->lock, key);
+		return -EINVAL;
+	}
+
+	if (put) {
+		pipe->put_claimed = 0;
+		pipe->bytes_used += size;
+		pipe->write_index += size;
+		if (pipe->write_index == pipe->size) {
+			pipe->write_index = 0;
+		}
+	} else {
+		pipe->get_claimed = 0;
+		pipe->bytes_used -= size;
+		pipe->read_index += size;
+		if (pipe->read_index == pipe->size) {
+			pipe->read_index = 0;
+		}
+	}
+
+	sys_dlist_init(&xfer_list);
+	if (size != 0) {
+		pipe_claim_serve(pipe, put ? &pipe->wait_q.readers :
+				 &pipe->wait_q.writers, &xfer_list, put);
+	}
+
+	if (sys_dlist_is_empty(&xfer_list)) {
+		k_spin_unlock(&pipe->lock, key);
+		return 0;
+	}
+
+	z_sched_lock();
+	k_spin_unlock(&pipe->lock, key);
+
+	while ((thread = (struct k_thread *)sys_dlist_get(&xfer_list)) != NULL) {
+		pipe_thread_ready(thread);
+	}
+
+	k_sched_unlock();
+
+	return 0;
+}
+
+int k_pipe_put_claim(struct k_pipe *pipe, void **data, size_t *size,
+		     s32_t timeout)
+{
+	return pipe_claim(pipe, data, size, timeout, true);
+}
+
+int k_pipe_put_commit(struct k_pipe *pipe, size_t size)
+{
+	return pipe_commit(pipe, size, true);
+}
+
+int k_pipe_get_claim(struct k_pipe *pipe, void **data, size_t *size,
+		     s32_t timeout)
+{
+	return pipe_claim(pipe, data, size, timeout, false);
+}
+
+int k_pipe_get_commit(struct k_pipe *pipe, size_t size)
+{
+	return pipe_commit(pipe, size, false);
+}
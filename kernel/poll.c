@@ -84,13 +84,31 @@ static inline bool is_condition_met(struct k_poll_event *event, u32_t *state)
 	return false;
 }
 
+/* Poll set events are registered with the set's thread-less poller */
+static inline bool is_set_event(struct k_poll_event *event)
+{
+#ifdef CONFIG_POLL_SET
+	return event->poller->thread == NULL;
+#else
+	return false;
+#endif
+}
+
 static inline void add_event(sys_dlist_t *events, struct k_poll_event *event,
 			     struct _poller *poller)
 {
 	struct k_poll_event *pending;
 
+#ifdef CONFIG_POLL_SET
+	/* Persistent set events are kept ahead of all k_poll() events */
+	if (poller->thread == NULL) {
+		sys_dlist_prepend(events, &event->_node);
+		return;
+	}
+#endif
+
 	pending = (struct k_poll_event *)sys_dlist_peek_tail(events);
-	if ((pending == NULL) ||
+	if ((pending == NULL) || is_set_event(pending) ||
 		z_is_t1_higher_prio_than_t2(pending->poller->thread,
 					    poller->thread)) {
 		sys_dlist_append(events, &event->_node);
@@ -98,7 +116,8 @@ static inline void add_event(sys_dlist_t *events, struct k_poll_event *event,
 	}
 
 	SYS_DLIST_FOR_EACH_CONTAINER(events, pending, _node) {
-		if (z_is_t1_higher_prio_than_t2(poller->thread,
+		if (!is_set_event(pending) &&
+		    z_is_t1_higher_prio_than_t2(poller->thread,
 						pending->poller->thread)) {
 			sys_dlist_insert(&pending->_node, &event->_node);
 			return;
@@ -120,6 +139,10 @@ static inline int register_event(struct k_poll_event *event,
 	case K_POLL_TYPE_DATA_AVAILABLE:
 		__ASSERT(event->queue != NULL, "invalid queue\n");
 		add_event(&event->queue->poll_events, event, poller);
+#ifdef CONFIG_QUEUE_LOCKFREE_APPEND
+		/* Make lock-free appenders take the waking path */
+		(void)atomic_inc(&event->queue->waiters);
+#endif
 		break;
 	case K_POLL_TYPE_SIGNAL:
 		__ASSERT(event->signal != NULL, "invalid poll signal\n");
@@ -153,6 +176,9 @@ static inline void clear_event_registration(struct k_poll_event *event)
 	case K_POLL_TYPE_DATA_AVAILABLE:
 		__ASSERT(event->queue != NULL, "invalid queue\n");
 		remove = true;
+#ifdef CONFIG_QUEUE_LOCKFREE_APPEND
+		(void)atomic_dec(&event->queue->waiters);
+#endif
 		break;
 	case K_POLL_TYPE_SIGNAL:
 		__ASSERT(event->signal != NULL, "invalid poll signal\n");
@@ -214,6 +240,16 @@ int z_impl_k_poll(struct k_poll_event *events, int num_events, s32_t timeout)
 			} else {
 				__ASSERT(false, "unexpected return code\n");
 			}
+
+#ifdef CONFIG_QUEUE_LOCKFREE_APPEND
+			/* A lock-free k_queue append may have slipped in
+			 * between the check above and the registration
+			 */
+			if (is_condition_met(&events[ii], &state)) {
+				set_event_ready(&events[ii], state);
+				poller.is_polling = false;
+			}
+#endif
 		}
 		k_spin_unlock(&lock, key);
 	}
@@ -371,14 +407,44 @@ ready_event:
 	return 0;
 }
 
-void z_handle_obj_poll_events(sys_dlist_t *events, u32_t state)
+#ifdef CONFIG_POLL_SET
+static void signal_set_event(struct k_poll_event *event, u32_t state);
+#endif
+
+/*
+ * Signal the events registered on an object: every poll set event,
+ * which stays registered, and the first (highest priority) k_poll()
+ * event, which is consumed.
+ */
+static int signal_obj_events(sys_dlist_t *events, u32_t state)
 {
 	struct k_poll_event *poll_event;
 
+#ifdef CONFIG_POLL_SET
+	SYS_DLIST_FOR_EACH_CONTAINER(events, poll_event, _node) {
+		if (!is_set_event(poll_event)) {
+			break;
+		}
+		signal_set_event(poll_event, state);
+	}
+
+	if (poll_event == NULL) {
+		return 0;
+	}
+	sys_dlist_remove(&poll_event->_node);
+#else
 	poll_event = (struct k_poll_event *)sys_dlist_get(events);
-	if (poll_event != NULL) {
-		(void) signal_poll_event(poll_event, state);
+	if (poll_event == NULL) {
+		return 0;
 	}
+#endif
+
+	return signal_poll_event(poll_event, state);
+}
+
+void z_handle_obj_poll_events(sys_dlist_t *events, u32_t state)
+{
+	(void)signal_obj_events(events, state);
 }
 
 void z_impl_k_poll_signal_init(struct k_poll_signal *signal)
@@ -421,18 +487,16 @@ Z_SYSCALL_HANDLER(k_poll_signal_check, signal, signaled, result)
 int z_impl_k_poll_signal_raise(struct k_poll_signal *signal, int result)
 {
 	k_spinlock_key_t key = k_spin_lock(&lock);
-	struct k_poll_event *poll_event;
 
 	signal->result = result;
 	signal->signaled = 1;
 
-	poll_event = (struct k_poll_event *)sys_dlist_get(&signal->poll_events);
-	if (poll_event == NULL) {
+	if (sys_dlist_is_empty(&signal->poll_events)) {
 		k_spin_unlock(&lock, key);
 		return 0;
 	}
 
-	int rc = signal_poll_event(poll_event, K_POLL_STATE_SIGNALED);
+	int rc = signal_obj_events(&signal->poll_events, K_POLL_STATE_SIGNALED);
 
 	z_reschedule(&lock, key);
 	return rc;
@@ -448,3 +512,171 @@ Z_SYSCALL_HANDLER1_SIMPLE_VOID(k_poll_signal_reset, K_OBJ_POLL_SIGNAL,
 			       struct k_poll_signal *);
 #endif
 
+#ifdef CONFIG_POLL_SET
+/*
+ * Poll sets.  Registration on the objects' poll_events lists is done
+ * under the subsystem lock like for k_poll(); the set's ready list and
+ * wait queue are protected by the set's own lock, since objects signal
+ * their events while holding their own locks.  Lock order is subsystem
+ * lock, then set lock.
+ */
+
+static inline struct k_poll_set *event_set(struct k_poll_event *event)
+{
+	return CONTAINER_OF(event->poller, struct k_poll_set, poller);
+}
+
+static void signal_set_event(struct k_poll_event *event, u32_t state)
+{
+	struct k_poll_set *set = event_set(event);
+	k_spinlock_key_t key = k_spin_lock(&set->lock);
+
+	if (!sys_dnode_is_linked(&event->_ready_node)) {
+		struct k_thread *thread;
+
+		event->state = K_POLL_STATE_NOT_READY;
+		sys_dlist_append(&set->ready, &event->_ready_node);
+
+		thread = z_unpend_first_thread(&set->wait_q);
+		if (thread != NULL) {
+			z_set_thread_return_value(thread, 0);
+			z_ready_thread(thread);
+		}
+	}
+
+	/* Already queued: coalesce into the pending report */
+	event->state |= state;
+
+	k_spin_unlock(&set->lock, key);
+}
+
+void k_poll_set_init(struct k_poll_set *set, u32_t flags)
+{
+	set->poller.thread = NULL;
+	set->poller.is_polling = false;
+	sys_dlist_init(&set->ready);
+	z_waitq_init(&set->wait_q);
+	set->flags = flags;
+}
+
+void k_poll_set_add(struct k_poll_set *set, struct k_poll_event *event)
+{
+	k_spinlock_key_t key = k_spin_lock(&lock);
+	u32_t state;
+
+	__ASSERT(event->poller == NULL, "event already registered\n");
+
+	sys_dnode_init(&event->_ready_node);
+	event->state = K_POLL_STATE_NOT_READY;
+	(void)register_event(event, &set->poller);
+
+	if (is_condition_met(event, &state)) {
+		signal_set_event(event, state);
+	}
+
+	k_spin_unlock(&lock, key);
+}
+
+void k_poll_set_remove(struct k_poll_set *set, struct k_poll_event *event)
+{
+	k_spinlock_key_t key = k_spin_lock(&lock);
+	k_spinlock_key_t set_key;
+
+	__ASSERT(event->poller == &set->poller, "event not in this set\n");
+
+	clear_event_registration(event);
+
+	set_key = k_spin_lock(&set->lock);
+	if (sys_dnode_is_linked(&event->_ready_node)) {
+		sys_dlist_remove(&event->_ready_node);
+	}
+	k_spin_unlock(&set->lock, set_key);
+
+	k_spin_unlock(&lock, key);
+}
+
+/* must be called with the set lock held */
+static int collect_ready(struct k_poll_set *set,
+			 struct k_poll_event **events, int max_events)
+{
+	bool edge = (set->flags & K_POLL_SET_EDGE) != 0U;
+	sys_dlist_t reported = SYS_DLIST_STATIC_INIT(&reported);
+	sys_dnode_t *node;
+	int n = 0;
+
+	while (n < max_events &&
+	       (node = sys_dlist_get(&set->ready)) != NULL) {
+		struct k_poll_event *event =
+			CONTAINER_OF(node, struct k_poll_event, _ready_node);
+		u32_t cancelled = event->state & K_POLL_STATE_CANCELLED;
+		u32_t state;
+
+		if (!edge) {
+			/* Level-triggered: report what holds right now */
+			event->state = cancelled;
+			if (is_condition_met(event, &state)) {
+				event->state |= state;
+			}
+			if (event->state == K_POLL_STATE_NOT_READY) {
+				continue;
+			}
+		}
+
+		events[n++] = event;
+
+		/*
+		 * Still-ready level events are requeued behind the others
+		 * so that a busy source can't starve the rest.  A cancelled
+		 * wait is only reported once.
+		 */
+		if (!edge && cancelled == 0U) {
+			sys_dlist_append(&reported, node);
+		}
+	}
+
+	while ((node = sys_dlist_get(&reported)) != NULL) {
+		sys_dlist_append(&set->ready, node);
+	}
+
+	return n;
+}
+
+int k_poll_set_wait(struct k_poll_set *set, struct k_poll_event **events,
+		    int max_events, s32_t timeout)
+{
+	__ASSERT(!z_is_in_isr() || timeout == K_NO_WAIT, "");
+	__ASSERT(max_events > 0, "zero events\n");
+
+	s64_t end = 0;
+
+	if (timeout > 0) {
+		end = z_tick_get() + z_ms_to_ticks(timeout);
+	}
+
+	while (true) {
+		k_spinlock_key_t key = k_spin_lock(&set->lock);
+		int n = collect_ready(set, events, max_events);
+
+		if (n > 0) {
+			k_spin_unlock(&set->lock, key);
+			return n;
+		}
+
+		if (timeout == K_NO_WAIT) {
+			k_spin_unlock(&set->lock, key);
+			return -EAGAIN;
+		}
+
+		if (z_pend_curr(&set->lock, key, &set->wait_q, timeout) != 0) {
+			return -EAGAIN;
+		}
+
+		/* Woken up, but another waiter may have taken the events */
+		if (timeout != K_FOREVER) {
+			s64_t left = end - z_tick_get();
+
+			timeout = left > 0 ? (s32_t)__ticks_to_ms(left) : K_NO_WAIT;
+		}
+	}
+}
+#endif /* CONFIG_POLL_SET */
@@ -86,6 +86,10 @@ void z_impl_k_queue_init(struct k_queue *queue)
 {
 	sys_sflist_init(&queue->data_q);
 	queue->lock = (struct k_spinlock) {};
+#ifdef CONFIG_QUEUE_LOCKFREE_APPEND
+	queue->incoming = NULL;
+	(void)atomic_set(&queue->waiters, 0);
+#endif
 	z_waitq_init(&queue->wait_q);
 #if defined(CONFIG_POLL)
 	sys_dlist_init(&queue->poll_events);
@@ -121,6 +125,102 @@ static inline void handle_poll_events(struct k_queue *queue, u32_t state)
 }
 #endif
 
+#ifdef CONFIG_QUEUE_LOCKFREE_APPEND
+/*
+ * Lock-free append fast path.
+ *
+ * While no thread is pended on or polling the queue, k_queue_append()
+ * pushes items onto the "incoming" LIFO with a single CAS, without
+ * taking the queue lock, waking anybody or rescheduling.  Everything
+ * that looks at data_q first moves incoming over to its tail (in
+ * order) with the lock held.
+ *
+ * Waiters bump "waiters" before their final emptiness check, and
+ * producers re-read it after pushing.  Both are sequentially
+ * consistent, so either the waiter sees the new item or the producer
+ * sees the waiter and falls back to the locked path to wake it.
+ */
+
+/* must be called with queue->lock held */
+static void flush_incoming(struct k_queue *queue)
+{
+	sys_sfnode_t *node = __atomic_exchange_n(&queue->incoming, NULL,
+						 __ATOMIC_SEQ_CST);
+	sys_sfnode_t *head = NULL;
+
+	/* Reverse the LIFO so items land in append order */
+	while (node != NULL) {
+		sys_sfnode_t *next = (sys_sfnode_t *)node->next_and_flags;
+
+		node->next_and_flags = (unative_t)head;
+		head = node;
+		node = next;
+	}
+
+	while (head != NULL) {
+		sys_sfnode_t *next = (sys_sfnode_t *)head->next_and_flags;
+
+		sys_sfnode_init(head, 0x0);
+		sys_sflist_append(&queue->data_q, head);
+		head = next;
+	}
+}
+
+void z_queue_flush_incoming(struct k_queue *queue)
+{
+	k_spinlock_key_t key = k_spin_lock(&queue->lock);
+
+	flush_incoming(queue);
+	k_spin_unlock(&queue->lock, key);
+}
+
+/* Returns false if a waiter showed up and must be woken */
+static bool append_lockfree(struct k_queue *queue, void *data)
+{
+	sys_sfnode_t *node = data;
+	sys_sfnode_t *head = __atomic_load_n(&queue->incoming,
+					     __ATOMIC_RELAXED);
+
+	do {
+		node->next_and_flags = (unative_t)head;
+	} while (!__atomic_compare_exchange_n(&queue->incoming, &head, node,
+					      true, __ATOMIC_SEQ_CST,
+					      __ATOMIC_RELAXED));
+
+	return atomic_get(&queue->waiters) == 0;
+}
+
+static void wake_waiter(struct k_queue *queue)
+{
+	k_spinlock_key_t key = k_spin_lock(&queue->lock);
+
+	flush_incoming(queue);
+
+#if !defined(CONFIG_POLL)
+	struct k_thread *thread = NULL;
+
+	if (!sys_sflist_is_empty(&queue->data_q)) {
+		thread = z_unpend_first_thread(&queue->wait_q);
+	}
+
+	if (thread != NULL) {
+		sys_sfnode_t *node = sys_sflist_get_not_empty(&queue->data_q);
+
+		prepare_thread_to_run(thread, z_queue_node_peek(node, true));
+	}
+#else
+	handle_poll_events(queue, K_POLL_STATE_DATA_AVAILABLE);
+#endif /* !CONFIG_POLL */
+
+	z_reschedule(&queue->lock, key);
+}
+#else
+static inline void flush_incoming(struct k_queue *queue)
+{
+	ARG_UNUSED(queue);
+}
+#endif /* CONFIG_QUEUE_LOCKFREE_APPEND */
+
 void z_impl_k_queue_cancel_wait(struct k_queue *queue)
 {
 	k_spinlock_key_t key = k_spin_lock(&queue->lock);
@@ -145,9 +245,14 @@ Z_SYSCALL_HANDLER1_SIMPLE_VOID(k_queue_cancel_wait, K_OBJ_QUEUE,
 #endif
 
 static s32_t queue_insert(struct k_queue *queue, void *prev, void *data,
-			  bool alloc)
+			  bool alloc, bool is_append)
 {
 	k_spinlock_key_t key = k_spin_lock(&queue->lock);
+
+	flush_incoming(queue);
+	if (is_append) {
+		prev = sys_sflist_peek_tail(&queue->data_q);
+	}
 #if !defined(CONFIG_POLL)
 	struct k_thread *first_pending_thread;
 
@@ -187,24 +292,31 @@ static s32_t queue_insert(struct k_queue *queue, void *prev, void *data,
 
 void k_queue_insert(struct k_queue *queue, void *prev, void *data)
 {
-	(void)queue_insert(queue, prev, data, false);
+	(void)queue_insert(queue, prev, data, false, false);
 }
 
 void k_queue_append(struct k_queue *queue, void *data)
 {
-	(void)queue_insert(queue, sys_sflist_peek_tail(&queue->data_q),
-			   data, false);
+#ifdef CONFIG_QUEUE_LOCKFREE_APPEND
+	if (atomic_get(&queue->waiters) == 0) {
+		if (!append_lockfree(queue, data)) {
+			wake_waiter(queue);
+		}
+		return;
+	}
+#endif
+
+	(void)queue_insert(queue, NULL, data, false, true);
 }
 
 void k_queue_prepend(struct k_queue *queue, void *data)
 {
-	(void)queue_insert(queue, NULL, data, false);
+	(void)queue_insert(queue, NULL, data, false, false);
 }
 
 s32_t z_impl_k_queue_alloc_append(struct k_queue *queue, void *data)
 {
-	return queue_insert(queue, sys_sflist_peek_tail(&queue->data_q), data,
-			    true);
+	return queue_insert(queue, NULL, data, true, true);
 }
 
 #ifdef CONFIG_USERSPACE
@@ -219,7 +331,7 @@ Z_SYSCALL_HANDLER(k_queue_alloc_append, queue, data)
 
 s32_t z_impl_k_queue_alloc_prepend(struct k_queue *queue, void *data)
 {
-	return queue_insert(queue, NULL, data, true);
+	return queue_insert(queue, NULL, data, true, false);
 }
 
 #ifdef CONFIG_USERSPACE
@@ -237,6 +349,8 @@ void k_queue_append_list(struct k_queue *queue, void *head, void *tail)
 	__ASSERT(head && tail, "invalid head or tail");
 
 	k_spinlock_key_t key = k_spin_lock(&queue->lock);
+
+	flush_incoming(queue);
 #if !defined(CONFIG_POLL)
 	struct k_thread *thread = NULL;
 
@@ -305,6 +419,7 @@ static void *k_queue_poll(struct k_queue *queue, s32_t timeout)
 		}
 
 		key = k_spin_lock(&queue->lock);
+		flush_incoming(queue);
 		val = z_queue_node_peek(sys_sflist_get(&queue->data_q), true);
 		k_spin_unlock(&queue->lock, key);
 
@@ -323,6 +438,7 @@ void *z_impl_k_queue_get(struct k_queue *queue, s32_t timeout)
 	k_spinlock_key_t key = k_spin_lock(&queue->lock);
 	void *data;
 
+	flush_incoming(queue);
 	if (likely(!sys_sflist_is_empty(&queue->data_q))) {
 		sys_sfnode_t *node;
 
@@ -343,8 +459,25 @@ void *z_impl_k_queue_get(struct k_queue *queue, s32_t timeout)
 	return k_queue_poll(queue, timeout);
 
 #else
+#ifdef CONFIG_QUEUE_LOCKFREE_APPEND
+	/* Announce ourselves, then look again for a racing append */
+	(void)atomic_inc(&queue->waiters);
+	flush_incoming(queue);
+	if (!sys_sflist_is_empty(&queue->data_q)) {
+		(void)atomic_dec(&queue->waiters);
+		data = z_queue_node_peek(
+			sys_sflist_get_not_empty(&queue->data_q), true);
+		k_spin_unlock(&queue->lock, key);
+		return data;
+	}
+#endif
+
 	int ret = z_pend_curr(&queue->lock, key, &queue->wait_q, timeout);
 
+#ifdef CONFIG_QUEUE_LOCKFREE_APPEND
+	(void)atomic_dec(&queue->waiters);
+#endif
+
 	return (ret != 0) ? NULL : _current->base.swap_data;
 #endif /* CONFIG_POLL */
 }
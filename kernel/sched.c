@@ -176,6 +176,64 @@ static ALWAYS_INLINE struct k_thread *_priq_dumb_mask_best(sys_dlist_t *pq)
 }
 #endif
 
+static ALWAYS_INLINE struct _ready_q *thread_runq(struct k_thread *thread)
+{
+#ifdef CONFIG_SCHED_CPU_RUNQ
+	return &_kernel.cpus[thread->base.runq_cpu].ready_q;
+#else
+	return &_kernel.ready_q;
+#endif
+}
+
+static ALWAYS_INLINE void runq_add(struct k_thread *thread)
+{
+#if defined(CONFIG_SCHED_CPU_RUNQ) && defined(CONFIG_SCHED_CPU_MASK)
+	/* Queue on the CPU the thread last ran on, unless its mask
+	 * no longer allows that one.
+	 */
+	u32_t mask = thread->base.cpu_mask & (BIT(CONFIG_MP_NUM_CPUS) - 1);
+
+	if ((mask & BIT(thread->base.runq_cpu)) == 0 && mask != 0) {
+		thread->base.runq_cpu = find_lsb_set(mask) - 1;
+	}
+#endif
+	_priq_run_add(&thread_runq(thread)->runq, thread);
+}
+
+static ALWAYS_INLINE void runq_remove(struct k_thread *thread)
+{
+	_priq_run_remove(&thread_runq(thread)->runq, thread);
+}
+
+static ALWAYS_INLINE struct k_thread *runq_best(void)
+{
+#ifdef CONFIG_SCHED_CPU_RUNQ
+	struct k_thread *th = _priq_run_best(&_current_cpu->ready_q.runq);
+
+	/* Steal the best thread of another CPU when ours is missing
+	 * or strictly less important, so the choice is the same one
+	 * a single global queue would have made.
+	 */
+	for (int i = 0; i < CONFIG_MP_NUM_CPUS; i++) {
+		struct k_thread *t;
+
+		if (i == _current_cpu->id) {
+			continue;
+		}
+
+		t = _priq_run_best(&_kernel.cpus[i].ready_q.runq);
+		if (t != NULL &&
+		    (th == NULL || z_is_t1_higher_prio_than_t2(t, th))) {
+			th = t;
+		}
+	}
+
+	return th;
+#else
+	return _priq_run_best(&_kernel.ready_q.runq);
+#endif
+}
+
 static ALWAYS_INLINE struct k_thread *next_up(void)
 {
 #ifndef CONFIG_SMP
@@ -185,7 +243,7 @@ static ALWAYS_INLINE struct k_thread *next_up(void)
 	 * responsible for putting it back in z_swap and ISR return!),
 	 * which makes this choice simple.
 	 */
-	struct k_thread *th = _priq_run_best(&_kernel.ready_q.runq);
+	struct k_thread *th = runq_best();
 
 	return th ? th : _current_cpu->idle_thread;
 #else
@@ -203,7 +261,7 @@ static ALWAYS_INLINE struct k_thread *next_up(void)
 	int active = !z_is_thread_prevented_from_running(_current);
 
 	/* Choose the best thread that is not current */
-	struct k_thread *th = _priq_run_best(&_kernel.ready_q.runq);
+	struct k_thread *th = runq_best();
 	if (th == NULL) {
 		th = _current_cpu->idle_thread;
 	}
@@ -221,15 +279,18 @@ static ALWAYS_INLINE struct k_thread *next_up(void)
 
 	/* Put _current back into the queue */
 	if (th != _current && active && !is_idle(_current) && !queued) {
-		_priq_run_add(&_kernel.ready_q.runq, _current);
+		runq_add(_current);
 		z_mark_thread_as_queued(_current);
 	}
 
 	/* Take the new _current out of the queue */
 	if (z_is_thread_queued(th)) {
-		_priq_run_remove(&_kernel.ready_q.runq, th);
+		runq_remove(th);
 	}
 	z_mark_thread_as_not_queued(th);
+#ifdef CONFIG_SCHED_CPU_RUNQ
+	th->base.runq_cpu = _current_cpu->id;
+#endif
 
 	return th;
 #endif
@@ -331,7 +392,7 @@ static void update_cache(int preempt_ok)
 void z_add_thread_to_ready_q(struct k_thread *thread)
 {
 	LOCKED(&sched_spinlock) {
-		_priq_run_add(&_kernel.ready_q.runq, thread);
+		runq_add(thread);
 		z_mark_thread_as_queued(thread);
 		update_cache(0);
 	}
@@ -340,8 +401,8 @@ void z_add_thread_to_ready_q(struct k_thread *thread)
 void z_move_thread_to_end_of_prio_q(struct k_thread *thread)
 {
 	LOCKED(&sched_spinlock) {
-		_priq_run_remove(&_kernel.ready_q.runq, thread);
-		_priq_run_add(&_kernel.ready_q.runq, thread);
+		runq_remove(thread);
+		runq_add(thread);
 		z_mark_thread_as_queued(thread);
 		update_cache(thread == _current);
 	}
@@ -351,7 +412,7 @@ void z_remove_thread_from_ready_q(struct k_thread *thread)
 {
 	LOCKED(&sched_spinlock) {
 		if (z_is_thread_queued(thread)) {
-			_priq_run_remove(&_kernel.ready_q.runq, thread);
+			runq_remove(thread);
 			z_mark_thread_as_not_queued(thread);
 			update_cache(thread == _current);
 		}
@@ -479,9 +540,9 @@ void z_thread_priority_set(struct k_thread *thread, int prio)
 		need_sched = z_is_thread_ready(thread);
 
 		if (need_sched) {
-			_priq_run_remove(&_kernel.ready_q.runq, thread);
+			runq_remove(thread);
 			thread->base.prio = prio;
-			_priq_run_add(&_kernel.ready_q.runq, thread);
+			runq_add(thread);
 			update_cache(1);
 		} else {
 			thread->base.prio = prio;
@@ -709,18 +770,30 @@ struct k_thread *z_priq_rb_best(struct _priq_rb *pq)
 	return t;
 }
 
-#ifdef CONFIG_SCHED_MULTIQ
-# if (K_LOWEST_THREAD_PRIO - K_HIGHEST_THREAD_PRIO) > 31
-# error Too many priorities for multiqueue scheduler (max 32)
-# endif
-#endif
-
 ALWAYS_INLINE void z_priq_mq_add(struct _priq_mq *pq, struct k_thread *thread)
 {
 	int priority_bit = thread->base.prio - K_HIGHEST_THREAD_PRIO;
+	sys_dlist_t *l = &pq->queues[priority_bit];
+
+	pq->bitmask[priority_bit >> 5] |= BIT(priority_bit & 31);
+#if PRIQ_BITMAP_WORDS > 1
+	pq->words |= BIT(priority_bit >> 5);
+#endif
+
+#ifdef CONFIG_SCHED_DEADLINE
+	struct k_thread *t;
+
+	/* Within a priority, keep the list in deadline order */
+	SYS_DLIST_FOR_EACH_CONTAINER(l, t, base.qnode_dlist) {
+		if (z_is_t1_higher_prio_than_t2(thread, t)) {
+			sys_dlist_insert(&t->base.qnode_dlist,
+					 &thread->base.qnode_dlist);
+			return;
+		}
+	}
+#endif
 
-	sys_dlist_append(&pq->queues[priority_bit], &thread->base.qnode_dlist);
-	pq->bitmask |= (1 << priority_bit);
+	sys_dlist_append(l, &thread->base.qnode_dlist);
 }
 
 ALWAYS_INLINE void z_priq_mq_remove(struct _priq_mq *pq, struct k_thread *thread)
@@ -735,18 +808,34 @@ ALWAYS_INLINE void z_priq_mq_remove(struct _priq_mq *pq, struct k_thread *thread
 
 	sys_dlist_remove(&thread->base.qnode_dlist);
 	if (sys_dlist_is_empty(&pq->queues[priority_bit])) {
-		pq->bitmask &= ~(1 << priority_bit);
+		pq->bitmask[priority_bit >> 5] &= ~BIT(priority_bit & 31);
+#if PRIQ_BITMAP_WORDS > 1
+		if (!pq->bitmask[priority_bit >> 5]) {
+			pq->words &= ~BIT(priority_bit >> 5);
+		}
+#endif
 	}
 }
 
 struct k_thread *z_priq_mq_best(struct _priq_mq *pq)
 {
-	if (!pq->bitmask) {
+#if PRIQ_BITMAP_WORDS > 1
+	if (!pq->words) {
+		return NULL;
+	}
+
+	int word = __builtin_ctz(pq->words);
+#else
+	if (!pq->bitmask[0]) {
 		return NULL;
 	}
 
+	int word = 0;
+#endif
+
 	struct k_thread *t = NULL;
-	sys_dlist_t *l = &pq->queues[__builtin_ctz(pq->bitmask)];
+	sys_dlist_t *l = &pq->queues[(word << 5) +
+				     __builtin_ctz(pq->bitmask[word])];
 	sys_dnode_t *n = sys_dlist_peek_head(l);
 
 	if (n != NULL) {
@@ -769,14 +858,14 @@ int z_unpend_all(_wait_q_t *wait_q)
 	return need_sched;
 }
 
-void z_sched_init(void)
+static void init_ready_q(struct _ready_q *rq)
 {
 #ifdef CONFIG_SCHED_DUMB
-	sys_dlist_init(&_kernel.ready_q.runq);
+	sys_dlist_init(&rq->runq);
 #endif
 
 #ifdef CONFIG_SCHED_SCALABLE
-	_kernel.ready_q.runq = (struct _priq_rb) {
+	rq->runq = (struct _priq_rb) {
 		.tree = {
 			.lessthan_fn = z_priq_rb_lessthan,
 		}
@@ -784,10 +873,21 @@ void z_sched_init(void)
 #endif
 
 #ifdef CONFIG_SCHED_MULTIQ
-	for (int i = 0; i < ARRAY_SIZE(_kernel.ready_q.runq.queues); i++) {
-		sys_dlist_init(&_kernel.ready_q.runq.queues[i]);
+	for (int i = 0; i < ARRAY_SIZE(rq->runq.queues); i++) {
+		sys_dlist_init(&rq->runq.queues[i]);
 	}
 #endif
+}
+
+void z_sched_init(void)
+{
+#ifdef CONFIG_SCHED_CPU_RUNQ
+	for (int i = 0; i < CONFIG_MP_NUM_CPUS; i++) {
+		init_ready_q(&_kernel.cpus[i].ready_q);
+	}
+#else
+	init_ready_q(&_kernel.ready_q);
+#endif
 
 #ifdef CONFIG_TIMESLICING
 	k_sched_time_slice_set(CONFIG_TIMESLICE_SIZE,
@@ -844,8 +944,8 @@ void z_impl_k_thread_deadline_set(k_tid_t tid, int deadline)
 	LOCKED(&sched_spinlock) {
 		th->base.prio_deadline = k_cycle_get_32() + deadline;
 		if (z_is_thread_queued(th)) {
-			_priq_run_remove(&_kernel.ready_q.runq, th);
-			_priq_run_add(&_kernel.ready_q.runq, th);
+			runq_remove(th);
+			runq_add(th);
 		}
 	}
 }
@@ -872,8 +972,8 @@ void z_impl_k_yield(void)
 
 	if (!is_idle(_current)) {
 		LOCKED(&sched_spinlock) {
-			_priq_run_remove(&_kernel.ready_q.runq, _current);
-			_priq_run_add(&_kernel.ready_q.runq, _current);
+			runq_remove(_current);
+			runq_add(_current);
 			update_cache(1);
 		}
 	}
@@ -9,6 +9,7 @@
 #include <spinlock.h>
 #include <kswap.h>
 #include <kernel_internal.h>
+#include <string.h>
 
 #ifdef CONFIG_SMP
 static atomic_t global_lock;
@@ -59,6 +60,134 @@ void z_smp_release_global_lock(struct k_thread *thread)
 	}
 }
 
+#ifdef CONFIG_SPINLOCK_MCS
+/* Number of MCS locks a CPU may hold at the same time */
+#define MCS_NEST_MAX 4
+
+struct mcs_node {
+	/* Successor in the queue, as node index + 1 */
+	atomic_t next;
+	/* Cleared by the predecessor to hand over the lock */
+	atomic_t wait;
+};
+
+/* Nodes are only ever allocated and freed by their own CPU with
+ * interrupts locked, so the per-CPU usage masks need no atomics.
+ */
+static struct mcs_node mcs_nodes[CONFIG_MP_NUM_CPUS * MCS_NEST_MAX];
+static u8_t mcs_used[CONFIG_MP_NUM_CPUS];
+
+static int mcs_node_alloc(void)
+{
+	int cpu = _current_cpu->id;
+
+	for (int i = 0; i < MCS_NEST_MAX; i++) {
+		if ((mcs_used[cpu] & BIT(i)) == 0U) {
+			mcs_used[cpu] |= BIT(i);
+			return cpu * MCS_NEST_MAX + i + 1;
+		}
+	}
+
+	__ASSERT(false, "too many nested MCS spinlocks");
+	return 0;
+}
+
+static void mcs_node_free(int id)
+{
+	mcs_used[(id - 1) / MCS_NEST_MAX] &= ~BIT((id - 1) % MCS_NEST_MAX);
+}
+
+u32_t z_spin_lock_mcs(struct k_spinlock *l)
+{
+	int id = mcs_node_alloc();
+	struct mcs_node *node = &mcs_nodes[id - 1];
+	atomic_val_t prev;
+	u32_t spins = 0U;
+
+	(void)atomic_set(&node->next, 0);
+	(void)atomic_set(&node->wait, 1);
+
+	prev = atomic_set(&l->tail, id);
+	if (prev != 0) {
+		(void)atomic_set(&mcs_nodes[prev - 1].next, id);
+
+		while (atomic_get(&node->wait) != 0) {
+			spins++;
+		}
+	}
+
+	l->node = id;
+
+	return spins;
+}
+
+void z_spin_unlock_mcs(struct k_spinlock *l)
+{
+	int id = l->node;
+	struct mcs_node *node = &mcs_nodes[id - 1];
+	atomic_val_t next = atomic_get(&node->next);
+
+	if (next == 0) {
+		/* No known successor: free the lock unless someone
+		 * swapped in behind us, in which case wait for them to
+		 * finish linking.
+		 */
+		if (atomic_cas(&l->tail, id, 0)) {
+			mcs_node_free(id);
+			return;
+		}
+
+		do {
+			next = atomic_get(&node->next);
+		} while (next == 0);
+	}
+
+	(void)atomic_clear(&mcs_nodes[next - 1].wait);
+	mcs_node_free(id);
+}
+#endif /* CONFIG_SPINLOCK_MCS */
+
+#ifdef CONFIG_SPINLOCK_STATS
+/* Both hooks run with the lock held, so plain updates are safe */
+void z_spin_stats_acquired(struct k_spinlock *l, u32_t spins)
+{
+	struct k_spinlock_stats *s = &l->stats;
+
+	s->acquired++;
+	if (spins != 0U) {
+		s->contended++;
+		s->spins += spins;
+		s->max_spins = MAX(s->max_spins, spins);
+	}
+
+	l->hold_start = k_cycle_get_32();
+}
+
+void z_spin_stats_released(struct k_spinlock *l)
+{
+	u32_t held = k_cycle_get_32() - l->hold_start;
+
+	l->stats.max_hold = MAX(l->stats.max_hold, held);
+}
+
+void k_spin_stats_get(struct k_spinlock *l, struct k_spinlock_stats *stats)
+{
+	*stats = l->stats;
+}
+
+void k_spin_stats_reset(struct k_spinlock *l)
+{
+	k_spinlock_key_t key = k_spin_lock(l);
+
+	(void)memset(&l->stats, 0, sizeof(l->stats));
+
+	/* Don't count the reset itself */
+	l->hold_start = k_cycle_get_32();
+
+	k_spin_unlock(l, key);
+}
+#endif /* CONFIG_SPINLOCK_STATS */
+
 #endif
 
 extern k_thread_stack_t _interrupt_stack1[];
@@ -17,8 +17,6 @@
 
 static u64_t curr_tick;
 
-static sys_dlist_t timeout_list = SYS_DLIST_STATIC_INIT(&timeout_list);
-
 static struct k_spinlock timeout_lock;
 
 static bool can_wait_forever;
@@ -26,10 +24,230 @@ static bool can_wait_forever;
 /* Cycles left to process in the currently-executing z_clock_announce() */
 static int announce_remaining;
 
+#ifdef CONFIG_TIMEOUT_SLACK
+/* Expiries that shared a z_clock_announce() with an earlier one */
+static u32_t wakeups_saved;
+#endif
+
 #if defined(CONFIG_TIMER_READS_ITS_FREQUENCY_AT_RUNTIME)
 int z_clock_hw_cycles_per_sec = CONFIG_SYS_CLOCK_HW_CYCLES_PER_SEC;
 #endif
 
+static s32_t elapsed(void)
+{
+	return announce_remaining == 0 ? z_clock_elapsed() : 0;
+}
+
+/* Timeout queue backends.  Each one provides:
+ *
+ * timeout_insert(): queue a timeout whose dticks is relative to
+ *     curr_tick, returning true if it is now the earliest one.
+ * remove_timeout(): unlink a queued timeout.
+ * timeout_dticks(): ticks from curr_tick until a queued timeout expires.
+ * first_dticks(): ticks from curr_tick until the earliest timeout
+ *     expires (possibly earlier, never later), or K_FOREVER.
+ * next_expired(): the next timeout due within announce_remaining
+ *     ticks, with its dticks set relative to curr_tick, or NULL.
+ * timeouts_advance(): account for curr_tick moving forward by the
+ *     given number of ticks with no further expiries.
+ */
+#ifdef CONFIG_TIMEOUT_QUEUE_WHEEL
+
+#define WHEEL_SLOT_BITS 5
+#define WHEEL_SLOTS BIT(WHEEL_SLOT_BITS)
+#define WHEEL_SLOT_MASK (WHEEL_SLOTS - 1)
+#define WHEEL_LEVELS CONFIG_TIMEOUT_WHEEL_LEVELS
+#define WHEEL_SHIFT(l) ((l) * WHEEL_SLOT_BITS)
+#define WHEEL_SPAN_MASK(l) ((((u64_t)1) << WHEEL_SHIFT(l)) - 1)
+
+struct wheel_slot {
+	sys_dlist_t list;
+	/* Earliest expiry added since the slot was last empty.  Aborts
+	 * don't update it, so it may be early but is never late.
+	 */
+	u64_t min;
+};
+
+/* Level N slot I holds timeouts whose expiry shares all digits above
+ * N with wheel_tick and has I as its Nth 5-bit digit.  Timeouts that
+ * don't share the digits above the last level live on the overflow
+ * list.  When wheel_tick reaches the start of a slot on level N > 0,
+ * its contents are "cascaded" (re-hashed) into the finer levels.
+ *
+ * Slot list heads are only initialized while their pending bit is
+ * set, the overflow list uses the extra bit at index WHEEL_LEVELS.
+ */
+static struct wheel_slot wheel[WHEEL_LEVELS][WHEEL_SLOTS];
+static struct wheel_slot wheel_overflow;
+static u32_t wheel_pending[WHEEL_LEVELS + 1];
+
+/* Tick the wheel has been advanced to.  Equal to curr_tick except
+ * transiently within z_clock_announce()
+ */
+static u64_t wheel_tick;
+
+static struct wheel_slot *wheel_slot(u64_t expiry, int *level, int *idx)
+{
+	u64_t diff = expiry ^ wheel_tick;
+	int l;
+
+	for (l = 0; l < WHEEL_LEVELS; l++) {
+		if ((diff >> WHEEL_SHIFT(l + 1)) == 0) {
+			*level = l;
+			*idx = (expiry >> WHEEL_SHIFT(l)) & WHEEL_SLOT_MASK;
+			return &wheel[l][*idx];
+		}
+	}
+
+	*level = WHEEL_LEVELS;
+	*idx = 0;
+	return &wheel_overflow;
+}
+
+/* First non-empty slot in expiry order: all of a level's slots expire
+ * before the next slot of the level above it starts.
+ */
+static struct wheel_slot *wheel_first(int *level, int *idx)
+{
+	for (int l = 0; l < WHEEL_LEVELS; l++) {
+		u32_t digit = (wheel_tick >> WHEEL_SHIFT(l)) & WHEEL_SLOT_MASK;
+		u32_t ahead = wheel_pending[l] & (0xffffffffU << digit);
+
+		if (ahead != 0U) {
+			*level = l;
+			*idx = find_lsb_set(ahead) - 1;
+			return &wheel[l][*idx];
+		}
+	}
+
+	if (wheel_pending[WHEEL_LEVELS] != 0U) {
+		*level = WHEEL_LEVELS;
+		*idx = 0;
+		return &wheel_overflow;
+	}
+
+	return NULL;
+}
+
+/* Tick at which wheel_tick reaches the given slot */
+static u64_t wheel_slot_tick(int level, int idx)
+{
+	if (level == WHEEL_LEVELS) {
+		return (wheel_tick | WHEEL_SPAN_MASK(WHEEL_LEVELS)) + 1;
+	}
+
+	return (wheel_tick & ~WHEEL_SPAN_MASK(level + 1)) +
+		((u64_t)idx << WHEEL_SHIFT(level));
+}
+
+static void wheel_insert(struct _timeout *to)
+{
+	int l, i;
+	struct wheel_slot *s = wheel_slot(to->expiry, &l, &i);
+
+	if ((wheel_pending[l] & BIT(i)) == 0U) {
+		sys_dlist_init(&s->list);
+		s->min = to->expiry;
+		wheel_pending[l] |= BIT(i);
+	} else if (to->expiry < s->min) {
+		s->min = to->expiry;
+	}
+
+	sys_dlist_append(&s->list, &to->node);
+}
+
+static void wheel_cascade(struct wheel_slot *s, int level, int idx)
+{
+	sys_dlist_t list;
+	sys_dnode_t *node;
+
+	/* Detach first: overflow entries may hash back into the
+	 * same slot
+	 */
+	sys_dlist_init(&list);
+	while ((node = sys_dlist_get(&s->list)) != NULL) {
+		sys_dlist_append(&list, node);
+	}
+	wheel_pending[level] &= ~BIT(idx);
+
+	while ((node = sys_dlist_get(&list)) != NULL) {
+		wheel_insert(CONTAINER_OF(node, struct _timeout, node));
+	}
+}
+
+static bool timeout_insert(struct _timeout *to)
+{
+	int l, i;
+
+	to->expiry = curr_tick + to->dticks;
+	wheel_insert(to);
+
+	return wheel_first(&l, &i)->min == to->expiry;
+}
+
+static void remove_timeout(struct _timeout *t)
+{
+	int l, i;
+	struct wheel_slot *s = wheel_slot(t->expiry, &l, &i);
+
+	sys_dlist_remove(&t->node);
+	if (sys_dlist_is_empty(&s->list)) {
+		wheel_pending[l] &= ~BIT(i);
+	}
+}
+
+static s32_t timeout_dticks(struct _timeout *t)
+{
+	return t->expiry - curr_tick;
+}
+
+static s32_t first_dticks(void)
+{
+	int l, i;
+	struct wheel_slot *s = wheel_first(&l, &i);
+
+	return s == NULL ? K_FOREVER : MIN(s->min - curr_tick, INT_MAX);
+}
+
+static struct _timeout *next_expired(void)
+{
+	u64_t target = curr_tick + announce_remaining;
+	struct wheel_slot *s;
+	int l, i;
+
+	while ((s = wheel_first(&l, &i)) != NULL) {
+		u64_t tick = wheel_slot_tick(l, i);
+
+		if (tick > target) {
+			break;
+		}
+
+		wheel_tick = tick;
+		if (l == 0) {
+			sys_dnode_t *node = sys_dlist_peek_head(&s->list);
+			struct _timeout *t = CONTAINER_OF(node,
+							  struct _timeout,
+							  node);
+
+			t->dticks = tick - curr_tick;
+			return t;
+		}
+
+		wheel_cascade(s, l, i);
+	}
+
+	return NULL;
+}
+
+static void timeouts_advance(s32_t ticks)
+{
+	wheel_tick = curr_tick + ticks;
+}
+
+#else /* CONFIG_TIMEOUT_QUEUE_DUMB */
+
+static sys_dlist_t timeout_list = SYS_DLIST_STATIC_INIT(&timeout_list);
+
 static struct _timeout *first(void)
 {
 	sys_dnode_t *t = sys_dlist_peek_head(&timeout_list);
@@ -53,16 +271,70 @@ static void remove_timeout(struct _timeout *t)
 	sys_dlist_remove(&t->node);
 }
 
-static s32_t elapsed(void)
+static bool timeout_insert(struct _timeout *to)
 {
-	return announce_remaining == 0 ? z_clock_elapsed() : 0;
+	struct _timeout *t;
+
+	for (t = first(); t != NULL; t = next(t)) {
+		__ASSERT(t->dticks >= 0, "");
+
+		if (t->dticks > to->dticks) {
+			t->dticks -= to->dticks;
+			sys_dlist_insert(&t->node, &to->node);
+			break;
+		}
+		to->dticks -= t->dticks;
+	}
+
+	if (t == NULL) {
+		sys_dlist_append(&timeout_list, &to->node);
+	}
+
+	return to == first();
+}
+
+static s32_t timeout_dticks(struct _timeout *timeout)
+{
+	s32_t ticks = 0;
+
+	for (struct _timeout *t = first(); t != NULL; t = next(t)) {
+		ticks += t->dticks;
+		if (timeout == t) {
+			break;
+		}
+	}
+
+	return ticks;
+}
+
+static s32_t first_dticks(void)
+{
+	struct _timeout *to = first();
+
+	return to == NULL ? K_FOREVER : to->dticks;
+}
+
+static struct _timeout *next_expired(void)
+{
+	struct _timeout *t = first();
+
+	return (t != NULL && t->dticks <= announce_remaining) ? t : NULL;
+}
+
+static void timeouts_advance(s32_t ticks)
+{
+	if (first() != NULL) {
+		first()->dticks -= ticks;
+	}
 }
 
+#endif /* CONFIG_TIMEOUT_QUEUE_WHEEL */
+
 static s32_t next_timeout(void)
 {
 	int maxw = can_wait_forever ? K_FOREVER : INT_MAX;
-	struct _timeout *to = first();
-	s32_t ret = to == NULL ? maxw : MAX(0, to->dticks - elapsed());
+	s32_t ticks = first_dticks();
+	s32_t ret = ticks == K_FOREVER ? maxw : MAX(0, ticks - elapsed());
 
 #ifdef CONFIG_TIMESLICING
 	if (_current_cpu->slice_ticks && _current_cpu->slice_ticks < ret) {
@@ -72,37 +344,62 @@ static s32_t next_timeout(void)
 	return ret;
 }
 
-void z_add_timeout(struct _timeout *to, _timeout_func_t fn, s32_t ticks)
+#ifdef CONFIG_TIMEOUT_SLACK
+/* Move an expiry dticks from curr_tick to the last tick within the
+ * following slack ticks that is a multiple of the largest power of two
+ * not above slack + 1.  Timeouts with the same or a larger slack that
+ * come due around the same time end up on the same tick, without
+ * having to search the queue for a partner.
+ */
+static s32_t slack_align(s32_t dticks, s32_t slack)
+{
+	u64_t grid = (u64_t)1 << (find_msb_set(slack + 1) - 1);
+	u64_t expiry = (curr_tick + dticks + slack) & ~(grid - 1);
+
+	return expiry - curr_tick;
+}
+#endif
+
+static void add_timeout(struct _timeout *to, _timeout_func_t fn,
+			s32_t ticks, s32_t slack)
 {
 	__ASSERT(!sys_dnode_is_linked(&to->node), "");
 	to->fn = fn;
 	ticks = MAX(1, ticks);
 
 	LOCKED(&timeout_lock) {
-		struct _timeout *t;
-
 		to->dticks = ticks + elapsed();
-		for (t = first(); t != NULL; t = next(t)) {
-			__ASSERT(t->dticks >= 0, "");
-
-			if (t->dticks > to->dticks) {
-				t->dticks -= to->dticks;
-				sys_dlist_insert(&t->node, &to->node);
-				break;
-			}
-			to->dticks -= t->dticks;
-		}
-
-		if (t == NULL) {
-			sys_dlist_append(&timeout_list, &to->node);
+#ifdef CONFIG_TIMEOUT_SLACK
+		if (slack > 0) {
+			to->dticks = slack_align(to->dticks, slack);
 		}
-
-		if (to == first()) {
+#else
+		ARG_UNUSED(slack);
+#endif
+		if (timeout_insert(to)) {
 			z_clock_set_timeout(next_timeout(), false);
 		}
 	}
 }
 
+void z_add_timeout(struct _timeout *to, _timeout_func_t fn, s32_t ticks)
+{
+	add_timeout(to, fn, ticks, 0);
+}
+
+#ifdef CONFIG_TIMEOUT_SLACK
+void z_add_timeout_slack(struct _timeout *to, _timeout_func_t fn,
+			 s32_t ticks, s32_t slack)
+{
+	add_timeout(to, fn, ticks, slack);
+}
+
+u32_t k_timeout_wakeups_saved(void)
+{
+	return wakeups_saved;
+}
+#endif
+
 int z_abort_timeout(struct _timeout *to)
 {
 	int ret = -EINVAL;
@@ -126,12 +423,7 @@ s32_t z_timeout_remaining(struct _timeout *timeout)
 	}
 
 	LOCKED(&timeout_lock) {
-		for (struct _timeout *t = first(); t != NULL; t = next(t)) {
-			ticks += t->dticks;
-			if (timeout == t) {
-				break;
-			}
-		}
+		ticks = timeout_dticks(timeout);
 	}
 
 	return ticks - elapsed();
@@ -173,13 +465,22 @@ void z_clock_announce(s32_t ticks)
 #endif
 
 	k_spinlock_key_t key = k_spin_lock(&timeout_lock);
+	struct _timeout *t;
+#ifdef CONFIG_TIMEOUT_SLACK
+	u32_t expired = 0U;
+#endif
 
 	announce_remaining = ticks;
 
-	while (first() != NULL && first()->dticks <= announce_remaining) {
-		struct _timeout *t = first();
+	while ((t = next_expired()) != NULL) {
 		int dt = t->dticks;
 
+#ifdef CONFIG_TIMEOUT_SLACK
+		if (expired++ > 0U) {
+			wakeups_saved++;
+		}
+#endif
+
 		curr_tick += dt;
 		announce_remaining -= dt;
 		t->dticks = 0;
@@ -190,10 +491,7 @@ void z_clock_announce(s32_t ticks)
 		key = k_spin_lock(&timeout_lock);
 	}
 
-	if (first() != NULL) {
-		first()->dticks -= announce_remaining;
-	}
-
+	timeouts_advance(announce_remaining);
 	curr_tick += announce_remaining;
 	announce_remaining = 0;
 
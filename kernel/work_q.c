@@ -46,8 +46,18 @@ void k_delayed_work_init(struct k_delayed_work *work, k_work_handler_t handler)
 	k_work_init(&work->work, handler);
 	z_init_timeout(&work->timeout, work_timeout);
 	work->work_q = NULL;
+#ifdef CONFIG_TIMEOUT_SLACK
+	work->slack = 0;
+#endif
 }
 
+#ifdef CONFIG_TIMEOUT_SLACK
+void k_delayed_work_slack_set(struct k_delayed_work *work, s32_t slack)
+{
+	work->slack = z_ms_to_ticks(slack);
+}
+#endif
+
 static int work_cancel(struct k_delayed_work *work)
 {
 	__ASSERT(work->work_q != NULL, "");
@@ -103,8 +113,13 @@ int k_delayed_work_submit_to_queue(struct k_work_q *work_q,
 	}
 
 	/* Add timeout */
+#ifdef CONFIG_TIMEOUT_SLACK
+	z_add_timeout_slack(&work->timeout, work_timeout,
+			    _TICK_ALIGN + z_ms_to_ticks(delay), work->slack);
+#else
 	z_add_timeout(&work->timeout, work_timeout,
 		     _TICK_ALIGN + z_ms_to_ticks(delay));
+#endif
 
 done:
 	k_spin_unlock(&work_q->lock, key);
@@ -7,6 +7,34 @@
  */
 
 #include <string.h>
+#include <stdint.h>
+
+/*
+ * Word-at-a-time helpers.  Word accesses go through a may_alias type so
+ * that the compiler doesn't assume they can't touch the bytes accessed
+ * by the caller.  Aligned word loads never cross a page or MPU region
+ * boundary, so the str* routines may read a few bytes past the
+ * terminator within the last word.
+ */
+typedef uintptr_t __attribute__((__may_alias__)) mem_word_t;
+
+#define WORD_SIZE sizeof(mem_word_t)
+#define WORD_MASK (WORD_SIZE - 1)
+#define ONES ((mem_word_t)-1 / 0xff)
+#define HIGHS (ONES << 7)
+
+/* Nonzero iff some byte of w is zero */
+#define HAS_ZERO(w) (((w) - ONES) & ~(w) & HIGHS)
+
+static inline uintptr_t misalign(const void *p)
+{
+	return (uintptr_t)p & WORD_MASK;
+}
+
+static inline mem_word_t splat(unsigned char c)
+{
+	return ONES * c;
+}
 
 /**
  *
@@ -67,6 +95,25 @@ char *strncpy(char *_MLIBC_RESTRICT d, const char *_MLIBC_RESTRICT s, size_t n)
 char *strchr(const char *s, int c)
 {
 	char tmp = (char) c;
+	const mem_word_t *w;
+	mem_word_t mask = splat((unsigned char)c);
+
+	while (misalign(s) != 0) {
+		if (*s == tmp) {
+			return (char *)s;
+		}
+		if (*s == '\0') {
+			return NULL;
+		}
+		s++;
+	}
+
+	/* Skip whole words holding neither the terminator nor c */
+	w = (const mem_word_t *)s;
+	while (!HAS_ZERO(*w) && !HAS_ZERO(*w ^ mask)) {
+		w++;
+	}
+	s = (const char *)w;
 
 	while ((*s != tmp) && (*s != '\0'))
 		s++;
@@ -103,14 +150,27 @@ char *strrchr(const char *s, int c)
 
 size_t strlen(const char *s)
 {
-	size_t n = 0;
+	const char *start = s;
+	const mem_word_t *w;
+
+	while (misalign(s) != 0) {
+		if (*s == '\0') {
+			return s - start;
+		}
+		s++;
+	}
+
+	w = (const mem_word_t *)s;
+	while (!HAS_ZERO(*w)) {
+		w++;
+	}
+	s = (const char *)w;
 
 	while (*s != '\0') {
 		s++;
-		n++;
 	}
 
-	return n;
+	return s - start;
 }
 
 /**
@@ -177,18 +237,109 @@ char *strncat(char *_MLIBC_RESTRICT dest, const char *_MLIBC_RESTRICT src,
  */
 int memcmp(const void *m1, const void *m2, size_t n)
 {
-	const char *c1 = m1;
-	const char *c2 = m2;
+	const unsigned char *c1 = m1;
+	const unsigned char *c2 = m2;
+
+	/* Skip equal words when both areas can be read a word at a time */
+	if (misalign(c1) == misalign(c2)) {
+		while (n > 0 && misalign(c1) != 0) {
+			if (*c1 != *c2) {
+				return *c1 - *c2;
+			}
+			c1++;
+			c2++;
+			n--;
+		}
 
-	if (!n)
-		return 0;
+		while (n >= WORD_SIZE &&
+		       *(const mem_word_t *)c1 == *(const mem_word_t *)c2) {
+			c1 += WORD_SIZE;
+			c2 += WORD_SIZE;
+			n -= WORD_SIZE;
+		}
+	}
 
-	while ((--n > 0) && (*c1 == *c2)) {
+	while (n > 0) {
+		if (*c1 != *c2) {
+			return *c1 - *c2;
+		}
 		c1++;
 		c2++;
+		n--;
 	}
 
-	return *c1 - *c2;
+	return 0;
+}
+
+/*
+ * Copy n bytes, n a multiple of WORD_SIZE, from a source that is not
+ * word aligned to a word aligned destination: load aligned source
+ * words and merge adjacent pairs with shifts, so every access is a
+ * full aligned word.  The aligned source words read may extend past
+ * the source area, but not past the words that contain it.
+ */
+static void copy_words_shifted(mem_word_t *d, const unsigned char *s,
+			       size_t n)
+{
+	uintptr_t off = misalign(s);
+	unsigned int lo = off * 8;
+	unsigned int hi = WORD_SIZE * 8 - lo;
+	const mem_word_t *w = (const mem_word_t *)(s - off);
+	mem_word_t cur = *w++;
+	mem_word_t next;
+
+	for (; n >= WORD_SIZE; n -= WORD_SIZE) {
+		next = *w++;
+#if __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
+		*d++ = (cur >> lo) | (next << hi);
+#else
+		*d++ = (cur << lo) | (next >> hi);
+#endif
+		cur = next;
+	}
+}
+
+/* Forward copy; also correct for overlapping areas with d < s */
+static void copy_forward(unsigned char *d, const unsigned char *s, size_t n)
+{
+	size_t words;
+
+	if (n >= 2 * WORD_SIZE) {
+		while (misalign(d) != 0) {
+			*(d++) = *(s++);
+			n--;
+		}
+
+		words = n & ~WORD_MASK;
+		if (misalign(s) == 0) {
+			mem_word_t *d_word = (mem_word_t *)d;
+			const mem_word_t *s_word = (const mem_word_t *)s;
+			size_t i = words / WORD_SIZE;
+
+			for (; i >= 4; i -= 4) {
+				d_word[0] = s_word[0];
+				d_word[1] = s_word[1];
+				d_word[2] = s_word[2];
+				d_word[3] = s_word[3];
+				d_word += 4;
+				s_word += 4;
+			}
+			while (i-- > 0) {
+				*(d_word++) = *(s_word++);
+			}
+		} else {
+			copy_words_shifted((mem_word_t *)d, s, words);
+		}
+
+		d += words;
+		s += words;
+		n -= words;
+	}
+
+	while (n > 0) {
+		*(d++) = *(s++);
+		n--;
+	}
 }
 
 /**
@@ -200,27 +351,39 @@ int memcmp(const void *m1, const void *m2, size_t n)
 
 void *memmove(void *d, const void *s, size_t n)
 {
-	char *dest = d;
-	const char *src  = s;
+	unsigned char *dest = d;
+	const unsigned char *src  = s;
 
 	if ((size_t) (dest - src) < n) {
 		/*
 		 * The <src> buffer overlaps with the start of the <dest> buffer.
-		 * Copy backwards to prevent the premature corruption of <src>.
+		 * Copy backwards to prevent the premature corruption of <src>,
+		 * a word at a time if both ends share their alignment.
 		 */
+		dest += n;
+		src += n;
+
+		if (misalign(dest) == misalign(src)) {
+			while (n > 0 && misalign(dest) != 0) {
+				*(--dest) = *(--src);
+				n--;
+			}
+
+			while (n >= WORD_SIZE) {
+				dest -= WORD_SIZE;
+				src -= WORD_SIZE;
+				*(mem_word_t *)dest = *(const mem_word_t *)src;
+				n -= WORD_SIZE;
+			}
+		}
 
 		while (n > 0) {
+			*(--dest) = *(--src);
 			n--;
-			dest[n] = src[n];
 		}
 	} else {
 		/* It is safe to perform a forward-copy */
-		while (n > 0) {
-			*dest = *src;
-			dest++;
-			src++;
-			n--;
-		}
+		copy_forward(dest, src, n);
 	}
 
 	return d;
@@ -235,43 +398,11 @@ void *memmove(void *d, const void *s, size_t n)
 
 void *memcpy(void *_MLIBC_RESTRICT d, const void *_MLIBC_RESTRICT s, size_t n)
 {
-	/* attempt word-sized copying only if buffers have identical alignment */
-
-	unsigned char *d_byte = (unsigned char *)d;
-	const unsigned char *s_byte = (const unsigned char *)s;
-
-	if ((((unsigned int)d ^ (unsigned int)s_byte) & 0x3) == 0) {
-
-		/* do byte-sized copying until word-aligned or finished */
-
-		while (((unsigned int)d_byte) & 0x3) {
-			if (n == 0) {
-				return d;
-			}
-			*(d_byte++) = *(s_byte++);
-			n--;
-		};
-
-		/* do word-sized copying as long as possible */
-
-		unsigned int *d_word = (unsigned int *)d_byte;
-		const unsigned int *s_word = (const unsigned int *)s_byte;
-
-		while (n >= sizeof(unsigned int)) {
-			*(d_word++) = *(s_word++);
-			n -= sizeof(unsigned int);
-		}
-
-		d_byte = (unsigned char *)d_word;
-		s_byte = (unsigned char *)s_word;
-	}
-
-	/* do byte-sized copying until finished */
-
-	while (n > 0) {
-		*(d_byte++) = *(s_byte++);
-		n--;
-	}
+	/*
+	 * Copy whole words once the destination is aligned, merging
+	 * source words with shifts if the source alignment differs.
+	 */
+	copy_forward(d, s, n);
 
 	return d;
 }
@@ -290,7 +421,7 @@ void *memset(void *buf, int c, size_t n)
 	unsigned char *d_byte = (unsigned char *)buf;
 	unsigned char c_byte = (unsigned char)c;
 
-	while (((unsigned int)d_byte) & 0x3) {
+	while (misalign(d_byte) != 0) {
 		if (n == 0) {
 			return buf;
 		}
@@ -300,15 +431,20 @@ void *memset(void *buf, int c, size_t n)
 
 	/* do word-sized initialization as long as possible */
 
-	unsigned int *d_word = (unsigned int *)d_byte;
-	unsigned int c_word = (unsigned int)(unsigned char)c;
+	mem_word_t *d_word = (mem_word_t *)d_byte;
+	mem_word_t c_word = splat(c_byte);
 
-	c_word |= c_word << 8;
-	c_word |= c_word << 16;
+	for (; n >= 4 * WORD_SIZE; n -= 4 * WORD_SIZE) {
+		d_word[0] = c_word;
+		d_word[1] = c_word;
+		d_word[2] = c_word;
+		d_word[3] = c_word;
+		d_word += 4;
+	}
 
-	while (n >= sizeof(unsigned int)) {
+	while (n >= WORD_SIZE) {
 		*(d_word++) = c_word;
-		n -= sizeof(unsigned int);
+		n -= WORD_SIZE;
 	}
 
 	/* do byte-sized initialization until finished */
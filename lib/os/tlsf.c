@@ -0,0 +1,275 @@
+/*
+ * Copyright (c) 2019 Intel Corporation
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <kernel.h>
+#include <string.h>
+#include <misc/__assert.h>
+#include <misc/tlsf.h>
+
+/*
+ * Every block starts with a two-word header: a pointer to the block
+ * physically before it and its total size, with the low bits used as
+ * flags.  Free blocks additionally link into their size class list
+ * through the first two words of what would be the payload.  The arena
+ * ends with a zero-payload "used" sentinel, so every real block has a
+ * physical successor that can be inspected without bounds checks.
+ */
+struct z_tlsf_block {
+	struct z_tlsf_block *prev_phys;
+	size_t size;
+	struct z_tlsf_block *next_free;
+	struct z_tlsf_block *prev_free;
+};
+
+#define BLOCK_FREE	BIT(0)
+#define FLAGS_MASK	((size_t)(Z_TLSF_ALIGN - 1))
+
+#define SMALL_BLOCK	((size_t)1 << Z_TLSF_FL_SHIFT)
+#define MIN_BLOCK	sizeof(struct z_tlsf_block)
+
+static inline size_t bsize(struct z_tlsf_block *b)
+{
+	return b->size & ~FLAGS_MASK;
+}
+
+static inline bool is_free(struct z_tlsf_block *b)
+{
+	return (b->size & BLOCK_FREE) != 0;
+}
+
+static inline void set_size(struct z_tlsf_block *b, size_t sz, bool free)
+{
+	b->size = sz | (free ? BLOCK_FREE : 0);
+}
+
+static inline struct z_tlsf_block *next_phys(struct z_tlsf_block *b)
+{
+	return (struct z_tlsf_block *)((u8_t *)b + bsize(b));
+}
+
+static inline void *payload(struct z_tlsf_block *b)
+{
+	return (u8_t *)b + Z_TLSF_HDR_SIZE;
+}
+
+static inline struct z_tlsf_block *from_payload(void *ptr)
+{
+	return (struct z_tlsf_block *)((u8_t *)ptr - Z_TLSF_HDR_SIZE);
+}
+
+static inline int msb(size_t sz)
+{
+	return 31 - __builtin_clz((u32_t)sz);
+}
+
+/* Size class a free block of @a sz bytes is filed under */
+static void mapping(size_t sz, int *fl, int *sl)
+{
+	if (sz < SMALL_BLOCK) {
+		*fl = 0;
+		*sl = sz >> Z_TLSF_ALIGN_LOG2;
+	} else {
+		int f = msb(sz);
+
+		*fl = f - Z_TLSF_FL_SHIFT + 1;
+		*sl = (sz >> (f - SYS_TLSF_SL_LOG2)) ^ SYS_TLSF_SL_COUNT;
+	}
+}
+
+/*
+ * Smallest size class whose blocks are all at least @a sz bytes
+ * ("good fit"), so the first block found needs no list walk.
+ */
+static bool mapping_search(size_t sz, int *fl, int *sl)
+{
+	if (sz >= SMALL_BLOCK) {
+		sz += ((size_t)1 << (msb(sz) - SYS_TLSF_SL_LOG2)) - 1;
+		if (sz > SYS_TLSF_MAX_BLOCK) {
+			return false;
+		}
+	}
+
+	mapping(sz, fl, sl);
+
+	return true;
+}
+
+static void free_list_add(struct sys_tlsf *h, struct z_tlsf_block *b)
+{
+	int fl, sl;
+	struct z_tlsf_block *head;
+
+	mapping(bsize(b), &fl, &sl);
+	head = h->free[fl][sl];
+
+	b->prev_free = NULL;
+	b->next_free = head;
+	if (head != NULL) {
+		head->prev_free = b;
+	}
+	h->free[fl][sl] = b;
+
+	h->fl_bitmap |= BIT(fl);
+	h->sl_bitmap[fl] |= BIT(sl);
+}
+
+static void free_list_remove(struct sys_tlsf *h, struct z_tlsf_block *b)
+{
+	int fl, sl;
+
+	mapping(bsize(b), &fl, &sl);
+
+	if (b->prev_free != NULL) {
+		b->prev_free->next_free = b->next_free;
+	} else {
+		h->free[fl][sl] = b->next_free;
+	}
+	if (b->next_free != NULL) {
+		b->next_free->prev_free = b->prev_free;
+	}
+
+	if (h->free[fl][sl] == NULL) {
+		h->sl_bitmap[fl] &= ~BIT(sl);
+		if (h->sl_bitmap[fl] == 0U) {
+			h->fl_bitmap &= ~BIT(fl);
+		}
+	}
+}
+
+static struct z_tlsf_block *find_free(struct sys_tlsf *h, int fl, int sl)
+{
+	u32_t sl_map = h->sl_bitmap[fl] & (~0U << sl);
+
+	if (sl_map == 0U) {
+		u32_t fl_map = h->fl_bitmap & (~0U << (fl + 1));
+
+		if (fl_map == 0U) {
+			return NULL;
+		}
+
+		fl = __builtin_ctz(fl_map);
+		sl_map = h->sl_bitmap[fl];
+	}
+
+	return h->free[fl][__builtin_ctz(sl_map)];
+}
+
+void sys_tlsf_init(struct sys_tlsf *h, void *mem, size_t bytes)
+{
+	uintptr_t start = ROUND_UP((uintptr_t)mem, Z_TLSF_ALIGN);
+	uintptr_t end = ROUND_DOWN((uintptr_t)mem + bytes, Z_TLSF_ALIGN);
+	struct z_tlsf_block *prev = NULL;
+	struct z_tlsf_block *b;
+
+	(void)memset(h, 0, sizeof(*h));
+
+	__ASSERT(end > start && end - start >= MIN_BLOCK + Z_TLSF_HDR_SIZE,
+		 "TLSF arena too small");
+
+	/* Leave room for the sentinel header at the very end */
+	end -= Z_TLSF_HDR_SIZE;
+
+	while (end - start >= MIN_BLOCK) {
+		size_t sz = MIN(end - start, SYS_TLSF_MAX_BLOCK);
+
+		/* Don't leave a tail too small to be a block */
+		if (end - start - sz != 0 && end - start - sz < MIN_BLOCK) {
+			sz -= MIN_BLOCK;
+		}
+
+		b = (struct z_tlsf_block *)start;
+		b->prev_phys = prev;
+		set_size(b, sz, true);
+		free_list_add(h, b);
+
+		prev = b;
+		start += sz;
+	}
+
+	/* Any sub-block leftover is simply folded into the sentinel */
+	b = (struct z_tlsf_block *)start;
+	b->prev_phys = prev;
+	set_size(b, 0, false);
+}
+
+void *sys_tlsf_alloc(struct sys_tlsf *h, size_t bytes)
+{
+	struct z_tlsf_block *b;
+	size_t sz, rest;
+	int fl, sl;
+
+	if (bytes == 0 || bytes > SYS_TLSF_MAX_BLOCK) {
+		return NULL;
+	}
+
+	sz = ROUND_UP(bytes + Z_TLSF_HDR_SIZE, Z_TLSF_ALIGN);
+	sz = MAX(sz, MIN_BLOCK);
+
+	if (!mapping_search(sz, &fl, &sl)) {
+		return NULL;
+	}
+
+	b = find_free(h, fl, sl);
+	if (b == NULL) {
+		return NULL;
+	}
+
+	free_list_remove(h, b);
+
+	rest = bsize(b) - sz;
+	if (rest >= MIN_BLOCK) {
+		struct z_tlsf_block *r = (struct z_tlsf_block *)((u8_t *)b + sz);
+
+		r->prev_phys = b;
+		set_size(r, rest, true);
+		next_phys(r)->prev_phys = r;
+		free_list_add(h, r);
+	} else {
+		sz = bsize(b);
+	}
+
+	set_size(b, sz, false);
+
+	return payload(b);
+}
+
+void sys_tlsf_free(struct sys_tlsf *h, void *ptr)
+{
+	struct z_tlsf_block *b, *n, *p;
+
+	if (ptr == NULL) {
+		return;
+	}
+
+	b = from_payload(ptr);
+	__ASSERT(!is_free(b), "double free of %p", ptr);
+
+	/* Merge with the following block */
+	n = next_phys(b);
+	if (is_free(n) && bsize(b) + bsize(n) <= SYS_TLSF_MAX_BLOCK) {
+		free_list_remove(h, n);
+		set_size(b, bsize(b) + bsize(n), false);
+		next_phys(b)->prev_phys = b;
+	}
+
+	/* Merge with the preceding block */
+	p = b->prev_phys;
+	if (p != NULL && is_free(p) &&
+	    bsize(p) + bsize(b) <= SYS_TLSF_MAX_BLOCK) {
+		free_list_remove(h, p);
+		set_size(p, bsize(p) + bsize(b), false);
+		next_phys(p)->prev_phys = p;
+		b = p;
+	}
+
+	set_size(b, bsize(b), true);
+	free_list_add(h, b);
+}
+
+size_t sys_tlsf_usable_size(void *ptr)
+{
+	return bsize(from_payload(ptr)) - Z_TLSF_HDR_SIZE;
+}
@@ -14,9 +14,15 @@
  *  2. From __start to main()
  *  3. From __start to task
  *  4. From __start to idle
+ *
+ * With CONFIG_DEVICE_INIT_TIMING, also report the time spent in each
+ * device's init function, and how much of it parallel device init
+ * saved on the POST_KERNEL and APPLICATION levels.
  */
 
 #include <zephyr.h>
+#include <device.h>
+#include <init.h>
 
 #include <tc_util.h>
 
@@ -25,6 +31,35 @@ extern u64_t __start_time_stamp;    /* timestamp when kernel begins executing */
 extern u64_t __main_time_stamp;     /* timestamp when main() begins executing */
 extern u64_t __idle_time_stamp;     /* timestamp when CPU went idle */
 
+#ifdef CONFIG_DEVICE_INIT_TIMING
+extern struct device __device_init_start[];
+extern struct device __device_POST_KERNEL_start[];
+extern struct device __device_init_end[];
+
+static void print_device_init_times(int freq)
+{
+	struct device *dev;
+	u32_t cycles, wall, sum = 0U;
+
+	for (dev = __device_init_start; dev < __device_init_end; dev++) {
+		cycles = device_init_cycles_get(dev);
+		TC_PRINT("init %-20s: %u cycles, %u us\n",
+			 dev->config->name, cycles, cycles / freq);
+
+		if (dev >= __device_POST_KERNEL_start) {
+			sum += cycles;
+		}
+	}
+
+	wall = device_init_level_cycles_get(_SYS_INIT_LEVEL_POST_KERNEL) +
+	       device_init_level_cycles_get(_SYS_INIT_LEVEL_APPLICATION);
+
+	TC_PRINT("post-kernel device init: %u us, sum of inits %u us, "
+		 "saved %d us\n", wall / freq, sum / freq,
+		 (s32_t)(sum - wall) / freq);
+}
+#endif
+
 void main(void)
 {
 	u64_t task_time_stamp;      /* timestamp at beginning of first task  */
@@ -72,6 +107,10 @@ void main(void)
 		 (u32_t)(s_idle_time_stamp & 0xFFFFFFFFULL),
 		 (u32_t)  (idle_us  & 0xFFFFFFFFULL));
 
+#ifdef CONFIG_DEVICE_INIT_TIMING
+	print_device_init_times(freq);
+#endif
+
 	TC_PRINT("Boot Time Measurement finished\n");
 
 	/* for sanity regression test utility. */
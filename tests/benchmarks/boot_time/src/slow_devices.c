@@ -0,0 +1,56 @@
+/*
+ * Copyright (c) 2019 Intel Corporation
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/**
+ * @file
+ * @brief Dummy devices with slow init functions
+ *
+ * Model drivers that block at boot waiting for hardware: two "PHYs"
+ * that wait for autonegotiation, an "Ethernet MAC" that needs the
+ * first PHY, and a "storage" device.  They are only built for the
+ * device init timing configurations, so the default boot time
+ * measurement is unaffected.
+ */
+
+#include <zephyr.h>
+#include <device.h>
+
+#ifdef CONFIG_DEVICE_INIT_TIMING
+
+struct slow_config {
+	s32_t delay;
+};
+
+static int slow_init(struct device *dev)
+{
+	const struct slow_config *cfg = dev->config->config_info;
+
+	k_sleep(cfg->delay);
+
+	return 0;
+}
+
+static const int slow_api;
+
+#define SLOW_DEVICE(name, delay_ms)					\
+	static const struct slow_config name##_config = {		\
+		.delay = delay_ms,					\
+	};								\
+	DEVICE_AND_API_INIT(name, #name, slow_init, NULL,		\
+			    &name##_config, POST_KERNEL,		\
+			    CONFIG_KERNEL_INIT_PRIORITY_DEVICE, &slow_api)
+
+SLOW_DEVICE(slow_phy0, 40);
+SLOW_DEVICE(slow_phy1, 40);
+SLOW_DEVICE(slow_mac0, 10);
+SLOW_DEVICE(slow_storage, 30);
+
+DEVICE_INIT_ASYNC(slow_phy0);
+DEVICE_INIT_ASYNC(slow_phy1);
+DEVICE_INIT_ASYNC(slow_mac0, "slow_phy0");
+DEVICE_INIT_ASYNC(slow_storage);
+
+#endif /* CONFIG_DEVICE_INIT_TIMING */
@@ -0,0 +1,83 @@
+/*
+ * Copyright (c) 2019 Intel Corporation
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr.h>
+#include <crc.h>
+#include <misc/printk.h>
+
+#define BUF_SIZE 4096
+#define ITERATIONS 16
+
+static u8_t buf[BUF_SIZE];
+
+enum variant {
+	CRC32_IEEE,
+	CRC16_CCITT,
+	CRC16_ITU_T,
+	CRC16_GENERIC,
+	CRC8_CCITT,
+	VARIANT_COUNT,
+};
+
+static const char *const names[VARIANT_COUNT] = {
+	"crc32_ieee", "crc16_ccitt", "crc16_itu_t", "crc16", "crc8_ccitt",
+};
+
+static u32_t seed = 12345;
+
+static u32_t next_rand(void)
+{
+	seed = seed * 1103515245 + 12345;
+	return seed >> 16;
+}
+
+static u32_t run(enum variant v)
+{
+	switch (v) {
+	case CRC32_IEEE:
+		return crc32_ieee(buf, sizeof(buf));
+	case CRC16_CCITT:
+		return crc16_ccitt(0xffff, buf, sizeof(buf));
+	case CRC16_ITU_T:
+		return crc16_itu_t(0, buf, sizeof(buf));
+	case CRC16_GENERIC:
+		return crc16(buf, sizeof(buf), 0x1021, 0xffff, true);
+	case CRC8_CCITT:
+		return crc8_ccitt(CRC8_CCITT_INITIAL_VALUE, buf, sizeof(buf));
+	default:
+		return 0;
+	}
+}
+
+void main(void)
+{
+	for (int i = 0; i < BUF_SIZE; i++) {
+		buf[i] = next_rand();
+	}
+
+	printk("CRC throughput over %d byte buffers\n", BUF_SIZE);
+
+	for (enum variant v = 0; v < VARIANT_COUNT; v++) {
+		u32_t crc = 0;
+		u32_t start, cycles;
+		u64_t kb_per_s;
+
+		start = k_cycle_get_32();
+		for (int i = 0; i < ITERATIONS; i++) {
+			crc = run(v);
+		}
+		cycles = MAX(k_cycle_get_32() - start, 1);
+
+		kb_per_s = ((u64_t)BUF_SIZE * ITERATIONS *
+			    sys_clock_hw_cycles_per_sec()) / (cycles * 1000ULL);
+
+		printk("%-12s %u.%03u MB/s (crc 0x%08x)\n", names[v],
+		       (u32_t)(kb_per_s / 1000), (u32_t)(kb_per_s % 1000),
+		       crc);
+	}
+
+	printk("fin\n");
+}
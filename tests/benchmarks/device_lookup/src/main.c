@@ -0,0 +1,120 @@
+/*
+ * Copyright (c) 2019 Intel Corporation
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr.h>
+#include <device.h>
+#include <misc/printk.h>
+#include <string.h>
+
+/* Resolves each of NUM_DEVICES dummy devices by name, by string
+ * constant and by a runtime copy of the name, and reports the cost.
+ */
+
+#define NUM_DEVICES 256
+#define ROUNDS 8
+
+static const int dummy_api;
+
+static int dummy_init(struct device *dev)
+{
+	ARG_UNUSED(dev);
+
+	return 0;
+}
+
+#define DUMMY_NAME(a, b) "dummy_" #a #b
+
+#define DUMMY(a, b)							\
+	DEVICE_AND_API_INIT(dummy_##a##b, DUMMY_NAME(a, b), dummy_init,	\
+			    NULL, NULL, POST_KERNEL,			\
+			    CONFIG_KERNEL_INIT_PRIORITY_DEVICE, &dummy_api)
+
+#define DUMMY16(a)							\
+	DUMMY(a, 0); DUMMY(a, 1); DUMMY(a, 2); DUMMY(a, 3);		\
+	DUMMY(a, 4); DUMMY(a, 5); DUMMY(a, 6); DUMMY(a, 7);		\
+	DUMMY(a, 8); DUMMY(a, 9); DUMMY(a, a); DUMMY(a, b);		\
+	DUMMY(a, c); DUMMY(a, d); DUMMY(a, e); DUMMY(a, f)
+
+DUMMY16(0); DUMMY16(1); DUMMY16(2); DUMMY16(3);
+DUMMY16(4); DUMMY16(5); DUMMY16(6); DUMMY16(7);
+DUMMY16(8); DUMMY16(9); DUMMY16(a); DUMMY16(b);
+DUMMY16(c); DUMMY16(d); DUMMY16(e); DUMMY16(f);
+
+static struct device *devices[NUM_DEVICES];
+static const char *names[NUM_DEVICES];
+
+/* Device name string constants, in device definition order */
+#define NAME16(a)							\
+	DUMMY_NAME(a, 0), DUMMY_NAME(a, 1), DUMMY_NAME(a, 2),		\
+	DUMMY_NAME(a, 3), DUMMY_NAME(a, 4), DUMMY_NAME(a, 5),		\
+	DUMMY_NAME(a, 6), DUMMY_NAME(a, 7), DUMMY_NAME(a, 8),		\
+	DUMMY_NAME(a, 9), DUMMY_NAME(a, a), DUMMY_NAME(a, b),		\
+	DUMMY_NAME(a, c), DUMMY_NAME(a, d), DUMMY_NAME(a, e),		\
+	DUMMY_NAME(a, f)
+
+static const char *const literal_names[NUM_DEVICES] = {
+	NAME16(0), NAME16(1), NAME16(2), NAME16(3),
+	NAME16(4), NAME16(5), NAME16(6), NAME16(7),
+	NAME16(8), NAME16(9), NAME16(a), NAME16(b),
+	NAME16(c), NAME16(d), NAME16(e), NAME16(f),
+};
+
+static void measure(const char *what, bool copy)
+{
+	char name[Z_DEVICE_MAX_NAME_LEN];
+	u32_t total = 0U, worst = 0U;
+	u32_t start, cycles;
+	struct device *dev;
+
+	for (int r = 0; r < ROUNDS; r++) {
+		for (int i = 0; i < NUM_DEVICES; i++) {
+			const char *lookup = names[i];
+
+			if (copy) {
+				strcpy(name, names[i]);
+				lookup = name;
+			}
+
+			start = k_cycle_get_32();
+			dev = device_get_binding(lookup);
+			cycles = k_cycle_get_32() - start;
+
+			if (dev != devices[i]) {
+				printk("lookup of %s failed\n", names[i]);
+			}
+
+			total += cycles;
+			worst = MAX(worst, cycles);
+		}
+	}
+
+	printk("%-16s avg %6u worst %6u cycles\n", what,
+	       total / (ROUNDS * NUM_DEVICES), worst);
+}
+
+void main(void)
+{
+	u32_t start, cycles;
+	struct device *dev;
+
+	for (int i = 0; i < NUM_DEVICES; i++) {
+		names[i] = literal_names[i];
+		devices[i] = device_get_binding(names[i]);
+	}
+
+	printk("device_get_binding(), %d dummy devices\n", NUM_DEVICES);
+
+	measure("string constant", false);
+	measure("runtime copy", true);
+
+	start = k_cycle_get_32();
+	dev = device_get_binding("no_such_device");
+	cycles = k_cycle_get_32() - start;
+	printk("%-16s %6u cycles%s\n", "missing name", cycles,
+	       dev == NULL ? "" : " (found?)");
+
+	printk("fin\n");
+}
@@ -0,0 +1,122 @@
+/*
+ * Copyright (c) 2019 Intel Corporation
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr.h>
+#include <misc/printk.h>
+
+/* N producers each put a batch of items into one k_fifo, then wait
+ * for the single consumer to have taken the whole batch before the
+ * next round.  Throughput is reported for 1, 2 and 4 producers.
+ */
+
+#define MAX_PRODUCERS 4
+#define BATCH 64
+#define ROUNDS 100
+#define STACK_SIZE 1024
+
+struct item {
+	void *fifo_reserved;
+	int owner;
+};
+
+static struct item items[MAX_PRODUCERS][BATCH];
+static int consumed[MAX_PRODUCERS];
+
+static K_FIFO_DEFINE(fifo);
+static struct k_sem batch_done[MAX_PRODUCERS];
+static K_SEM_DEFINE(producers_done, 0, MAX_PRODUCERS);
+
+static K_THREAD_STACK_ARRAY_DEFINE(producer_stacks, MAX_PRODUCERS,
+				   STACK_SIZE);
+static struct k_thread producer_threads[MAX_PRODUCERS];
+static K_THREAD_STACK_DEFINE(consumer_stack, STACK_SIZE);
+static struct k_thread consumer_thread;
+
+static void producer(void *arg1, void *arg2, void *arg3)
+{
+	int id = (int)arg1;
+
+	ARG_UNUSED(arg2);
+	ARG_UNUSED(arg3);
+
+	for (int r = 0; r < ROUNDS; r++) {
+		for (int i = 0; i < BATCH; i++) {
+			k_fifo_put(&fifo, &items[id][i]);
+		}
+		k_sem_take(&batch_done[id], K_FOREVER);
+	}
+
+	k_sem_give(&producers_done);
+}
+
+static void consumer(void *arg1, void *arg2, void *arg3)
+{
+	ARG_UNUSED(arg1);
+	ARG_UNUSED(arg2);
+	ARG_UNUSED(arg3);
+
+	while (true) {
+		struct item *it = k_fifo_get(&fifo, K_FOREVER);
+
+		if (++consumed[it->owner] == BATCH) {
+			consumed[it->owner] = 0;
+			k_sem_give(&batch_done[it->owner]);
+		}
+	}
+}
+
+static void run(int n_producers, int prio)
+{
+	u32_t n_items = n_producers * BATCH * ROUNDS;
+	u32_t start, cycles;
+
+	for (int i = 0; i < n_producers; i++) {
+		k_sem_init(&batch_done[i], 0, 1);
+	}
+
+	start = k_cycle_get_32();
+
+	for (int i = 0; i < n_producers; i++) {
+		k_thread_create(&producer_threads[i], producer_stacks[i],
+				STACK_SIZE, producer, (void *)i, NULL, NULL,
+				prio, 0, 0);
+	}
+
+	for (int i = 0; i < n_producers; i++) {
+		k_sem_take(&producers_done, K_FOREVER);
+	}
+
+	cycles = k_cycle_get_32() - start;
+
+	printk("%d producer(s): %u items, %u cycles/item, %u items/sec\n",
+	       n_producers, n_items, cycles / n_items,
+	       (u32_t)(((u64_t)n_items * sys_clock_hw_cycles_per_sec()) /
+		       cycles));
+}
+
+void main(void)
+{
+	int prio = k_thread_priority_get(k_current_get()) + 1;
+
+	for (int i = 0; i < MAX_PRODUCERS; i++) {
+		for (int j = 0; j < BATCH; j++) {
+			items[i][j].owner = i;
+		}
+	}
+
+	k_thread_create(&consumer_thread, consumer_stack, STACK_SIZE,
+			consumer, NULL, NULL, NULL, prio, 0, 0);
+
+	printk("k_fifo throughput (%s put path)\n",
+	       IS_ENABLED(CONFIG_QUEUE_LOCKFREE_APPEND) ?
+	       "lock-free" : "locked");
+
+	for (int n = 1; n <= MAX_PRODUCERS; n *= 2) {
+		run(n, prio);
+	}
+
+	printk("fin\n");
+}
@@ -0,0 +1,133 @@
+/*
+ * Copyright (c) 2019 Intel Corporation
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr.h>
+#include <string.h>
+#include <misc/printk.h>
+
+/* Runs each string routine over a range of sizes and alignments and
+ * reports its throughput.
+ */
+
+#define MAX_SIZE 4096
+#define MIN_BYTES (64 * 1024)
+
+static u8_t __aligned(16) buf_a[MAX_SIZE + 16];
+static u8_t __aligned(16) buf_b[MAX_SIZE + 16];
+
+enum op {
+	OP_MEMCPY,
+	OP_MEMMOVE_FWD,
+	OP_MEMMOVE_BWD,
+	OP_MEMSET,
+	OP_MEMCMP,
+	OP_STRLEN,
+	OP_STRCHR,
+	OP_COUNT,
+};
+
+static const char *const op_names[OP_COUNT] = {
+	"memcpy", "memmove fwd", "memmove bwd", "memset", "memcmp",
+	"strlen", "strchr",
+};
+
+/* Keeps results alive so the calls are not optimized away */
+static volatile uintptr_t sink;
+
+static void run_op(enum op op, size_t size, int d_off, int s_off)
+{
+	u8_t *d = buf_a + d_off;
+	u8_t *s = buf_b + s_off;
+
+	switch (op) {
+	case OP_MEMCPY:
+		sink = (uintptr_t)memcpy(d, s, size);
+		break;
+	case OP_MEMMOVE_FWD:
+		/* destination below the source, overlapping */
+		sink = (uintptr_t)memmove(buf_a + d_off, buf_a + 8 + s_off,
+					  size);
+		break;
+	case OP_MEMMOVE_BWD:
+		/* destination above the source, overlapping */
+		sink = (uintptr_t)memmove(buf_a + 8 + d_off, buf_a + s_off,
+					  size);
+		break;
+	case OP_MEMSET:
+		sink = (uintptr_t)memset(d, 0x5a, size);
+		break;
+	case OP_MEMCMP:
+		sink = memcmp(d, s, size);
+		break;
+	case OP_STRLEN:
+		sink = strlen((const char *)s);
+		break;
+	case OP_STRCHR:
+		sink = (uintptr_t)strchr((const char *)s, 'z');
+		break;
+	default:
+		break;
+	}
+}
+
+static void prepare(enum op op, size_t size, int s_off)
+{
+	(void)memset(buf_a, 'a', sizeof(buf_a));
+	(void)memset(buf_b, 'a', sizeof(buf_b));
+
+	if (op == OP_STRLEN || op == OP_STRCHR) {
+		/* string of size - 1 characters, 'z' not present */
+		buf_b[s_off + size - 1] = '\0';
+	}
+}
+
+static void measure(enum op op, size_t size, int d_off, int s_off)
+{
+	u32_t reps = MAX(MIN_BYTES / size, 1);
+	u32_t start, cycles;
+	u64_t bytes_per_us;
+
+	prepare(op, size, s_off);
+
+	start = k_cycle_get_32();
+	for (u32_t i = 0; i < reps; i++) {
+		run_op(op, size, d_off, s_off);
+	}
+	cycles = k_cycle_get_32() - start;
+
+	bytes_per_us = ((u64_t)size * reps * sys_clock_hw_cycles_per_sec()) /
+		       ((u64_t)MAX(cycles, 1) * USEC_PER_SEC);
+
+	printk("%-12s %5u bytes, offsets %d/%d: %u bytes/us\n",
+	       op_names[op], (u32_t)size, d_off, s_off, (u32_t)bytes_per_us);
+}
+
+void main(void)
+{
+	static const int offsets[][2] = {
+		{ 0, 0 }, { 1, 1 }, { 0, 1 }, { 0, 3 },
+	};
+
+	printk("minimal libc string routines, %u bytes per measurement\n",
+	       MIN_BYTES);
+
+	for (enum op op = 0; op < OP_COUNT; op++) {
+		bool copy = (op == OP_MEMCPY || op == OP_MEMMOVE_FWD ||
+			     op == OP_MEMMOVE_BWD || op == OP_MEMCMP);
+
+		for (size_t size = 8; size <= MAX_SIZE; size *= 8) {
+			for (size_t o = 0; o < ARRAY_SIZE(offsets); o++) {
+				/* single buffer routines: only the offset */
+				if (!copy && offsets[o][0] != 0) {
+					continue;
+				}
+				measure(op, size, offsets[o][0], offsets[o][1]);
+			}
+		}
+	}
+
+	printk("fin\n");
+}
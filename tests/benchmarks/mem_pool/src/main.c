@@ -0,0 +1,117 @@
+/*
+ * Copyright (c) 2019 Intel Corporation
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr.h>
+#include <misc/printk.h>
+
+/* Replays a deterministic random alloc/free trace against one memory
+ * pool and reports per-operation latency and fragmentation.  The
+ * allocator under test is selected with CONFIG_MEM_POOL_*.
+ */
+
+#define MAX_BLOCK 4096
+#define N_MAX_BLOCKS 4
+#define N_SLOTS 64
+#define N_OPS 20000
+
+K_MEM_POOL_DEFINE(bench_pool, 16, MAX_BLOCK, N_MAX_BLOCKS, 4);
+
+static struct {
+	void *ptr;
+	size_t size;
+} slots[N_SLOTS];
+
+/* Cheap deterministic LCG so runs are repeatable across allocators */
+static u32_t rand_state = 1U;
+
+static u32_t next_rand(void)
+{
+	rand_state = rand_state * 1103515245U + 12345U;
+	return rand_state >> 16;
+}
+
+/* Mostly small requests, some medium ones and a few large ones */
+static size_t next_size(void)
+{
+	u32_t r = next_rand() % 10;
+
+	if (r < 6) {
+		return 8 + next_rand() % 121;
+	} else if (r < 9) {
+		return 129 + next_rand() % 896;
+	} else {
+		return 1025 + next_rand() % 2000;
+	}
+}
+
+void main(void)
+{
+	u32_t alloc_tot = 0U, alloc_max = 0U, n_alloc = 0U;
+	u32_t free_tot = 0U, free_max = 0U, n_free = 0U;
+	u32_t n_fail = 0U;
+	u64_t util_sum = 0U;
+	u32_t util_min = 100U;
+	size_t live = 0;
+
+	printk("k_mem_pool trace replay (%s allocator, %u byte buffer)\n",
+	       IS_ENABLED(CONFIG_MEM_POOL_TLSF) ? "TLSF" : "buddy",
+	       (u32_t)sizeof(_mpool_buf_bench_pool));
+
+	for (int op = 0; op < N_OPS; op++) {
+		int i = next_rand() % N_SLOTS;
+		u32_t t0, dt;
+
+		if (slots[i].ptr != NULL) {
+			t0 = k_cycle_get_32();
+			k_free(slots[i].ptr);
+			dt = k_cycle_get_32() - t0;
+
+			free_tot += dt;
+			free_max = MAX(free_max, dt);
+			n_free++;
+
+			live -= slots[i].size;
+			slots[i].ptr = NULL;
+			continue;
+		}
+
+		slots[i].size = next_size();
+
+		t0 = k_cycle_get_32();
+		slots[i].ptr = k_mem_pool_malloc(&bench_pool, slots[i].size);
+		dt = k_cycle_get_32() - t0;
+
+		alloc_tot += dt;
+		alloc_max = MAX(alloc_max, dt);
+		n_alloc++;
+
+		if (slots[i].ptr != NULL) {
+			live += slots[i].size;
+		} else {
+			u32_t util = (live * 100U) /
+				     sizeof(_mpool_buf_bench_pool);
+
+			util_sum += util;
+			util_min = MIN(util_min, util);
+			n_fail++;
+		}
+	}
+
+	for (int i = 0; i < N_SLOTS; i++) {
+		k_free(slots[i].ptr);
+	}
+
+	printk("alloc: %u ops, avg %u max %u cycles\n",
+	       n_alloc, alloc_tot / n_alloc, alloc_max);
+	printk("free:  %u ops, avg %u max %u cycles\n",
+	       n_free, free_tot / MAX(n_free, 1U), free_max);
+	printk("failed allocs: %u, buffer utilization at failure: "
+	       "avg %u%% min %u%%\n", n_fail,
+	       n_fail != 0U ? (u32_t)(util_sum / n_fail) : 100U,
+	       n_fail != 0U ? util_min : 100U);
+
+	printk("fin\n");
+}
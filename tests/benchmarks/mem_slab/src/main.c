@@ -0,0 +1,103 @@
+/*
+ * Copyright (c) 2019 Intel Corporation
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr.h>
+#include <misc/printk.h>
+
+/* N threads share one slab, each allocating a few blocks and freeing
+ * them again in a loop.  Throughput is reported for 1, 2 and 4 threads,
+ * against a plain slab and against one with per-CPU caches.
+ */
+
+#define MAX_THREADS 4
+#define BLOCK_SIZE 64
+#define NUM_BLOCKS 64
+#define HELD 4
+#define ITERATIONS 10000
+#define STACK_SIZE 1024
+
+K_MEM_SLAB_DEFINE(plain_slab, BLOCK_SIZE, NUM_BLOCKS, 4);
+K_MEM_SLAB_DEFINE_CACHED(cached_slab, BLOCK_SIZE, NUM_BLOCKS, 4);
+
+static K_THREAD_STACK_ARRAY_DEFINE(stacks, MAX_THREADS, STACK_SIZE);
+static struct k_thread threads[MAX_THREADS];
+static K_SEM_DEFINE(start_sem, 0, MAX_THREADS);
+static K_SEM_DEFINE(done_sem, 0, MAX_THREADS);
+
+static void worker(void *arg1, void *arg2, void *arg3)
+{
+	struct k_mem_slab *slab = arg1;
+	void *blocks[HELD];
+
+	ARG_UNUSED(arg2);
+	ARG_UNUSED(arg3);
+
+	k_sem_take(&start_sem, K_FOREVER);
+
+	for (int i = 0; i < ITERATIONS; i++) {
+		for (int j = 0; j < HELD; j++) {
+			if (k_mem_slab_alloc(slab, &blocks[j], K_FOREVER) != 0) {
+				printk("alloc failed\n");
+				k_oops();
+			}
+		}
+		for (int j = 0; j < HELD; j++) {
+			k_mem_slab_free(slab, &blocks[j]);
+		}
+	}
+
+	k_sem_give(&done_sem);
+}
+
+static void run(struct k_mem_slab *slab, const char *name, int n_threads,
+		int prio)
+{
+	u32_t n_ops = n_threads * HELD * ITERATIONS;
+	u32_t start, cycles;
+
+	for (int i = 0; i < n_threads; i++) {
+		k_thread_create(&threads[i], stacks[i], STACK_SIZE, worker,
+				slab, NULL, NULL, prio, 0, 0);
+	}
+
+	/* Let all workers start at once */
+	k_sleep(10);
+	start = k_cycle_get_32();
+
+	for (int i = 0; i < n_threads; i++) {
+		k_sem_give(&start_sem);
+	}
+	for (int i = 0; i < n_threads; i++) {
+		k_sem_take(&done_sem, K_FOREVER);
+	}
+
+	cycles = k_cycle_get_32() - start;
+
+	/* Make sure the workers are gone before their objects are reused */
+	for (int i = 0; i < n_threads; i++) {
+		k_thread_abort(&threads[i]);
+	}
+
+	printk("%s slab, %d thread(s): %u cycles/alloc+free, %u used\n",
+	       name, n_threads, cycles / n_ops,
+	       k_mem_slab_num_used_get(slab));
+}
+
+void main(void)
+{
+	int prio = k_thread_priority_get(k_current_get()) + 1;
+
+	printk("k_mem_slab contention (per-CPU caches %s, %d CPU(s))\n",
+	       IS_ENABLED(CONFIG_MEM_SLAB_CPU_CACHE) ? "on" : "off",
+	       CONFIG_MP_NUM_CPUS);
+
+	for (int n = 1; n <= MAX_THREADS; n *= 2) {
+		run(&plain_slab, "plain", n, prio);
+		run(&cached_slab, "cached", n, prio);
+	}
+
+	printk("fin\n");
+}
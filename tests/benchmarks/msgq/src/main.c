@@ -0,0 +1,123 @@
+/*
+ * Copyright (c) 2019 Intel Corporation
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr.h>
+#include <misc/printk.h>
+
+/* Pushes TOTAL_MSGS messages through a message queue, moving them one
+ * at a time or in batches, and reports the throughput.
+ */
+
+#define MSG_WORDS 4
+#define QUEUE_LEN 64
+#define TOTAL_MSGS (64 * 1024)
+#define MAX_BATCH 32
+#define STACK_SIZE 1024
+
+struct msg {
+	u32_t word[MSG_WORDS];
+};
+
+K_MSGQ_DEFINE(msgq, sizeof(struct msg), QUEUE_LEN, 4);
+
+static K_THREAD_STACK_DEFINE(consumer_stack, STACK_SIZE);
+static struct k_thread consumer_thread;
+static K_SEM_DEFINE(consumer_done, 0, 1);
+
+static u32_t batch_size;
+static u32_t checksum;
+
+static void consumer(void *arg1, void *arg2, void *arg3)
+{
+	struct msg batch[MAX_BATCH];
+	u32_t done = 0U;
+	int n;
+
+	ARG_UNUSED(arg1);
+	ARG_UNUSED(arg2);
+	ARG_UNUSED(arg3);
+
+	checksum = 0U;
+
+	while (done < TOTAL_MSGS) {
+		if (batch_size == 1U) {
+			k_msgq_get(&msgq, &batch[0], K_FOREVER);
+			n = 1;
+		} else {
+			n = k_msgq_get_many(&msgq, batch, batch_size,
+					    K_FOREVER);
+		}
+
+		for (int i = 0; i < n; i++) {
+			checksum += batch[i].word[0];
+		}
+		done += n;
+	}
+
+	k_sem_give(&consumer_done);
+}
+
+static void produce(void)
+{
+	struct msg batch[MAX_BATCH];
+	u32_t done = 0U;
+	u32_t count;
+	int n;
+
+	while (done < TOTAL_MSGS) {
+		count = MIN(batch_size, TOTAL_MSGS - done);
+		for (u32_t i = 0; i < count; i++) {
+			batch[i].word[0] = done + i;
+		}
+
+		if (batch_size == 1U) {
+			k_msgq_put(&msgq, &batch[0], K_FOREVER);
+			done++;
+			continue;
+		}
+
+		/* a blocking batch call may only move part of the batch */
+		for (u32_t i = 0; i < count; i += n) {
+			n = k_msgq_put_many(&msgq, &batch[i], count - i,
+					    K_FOREVER);
+		}
+		done += count;
+	}
+}
+
+static void run(u32_t batch, int prio)
+{
+	u32_t start, cycles;
+
+	k_msgq_purge(&msgq);
+	batch_size = batch;
+
+	k_thread_create(&consumer_thread, consumer_stack, STACK_SIZE,
+			consumer, NULL, NULL, NULL, prio, 0, 0);
+
+	start = k_cycle_get_32();
+	produce();
+	k_sem_take(&consumer_done, K_FOREVER);
+	cycles = k_cycle_get_32() - start;
+
+	printk("batch %2u: %u msgs/sec (checksum %08x)\n", batch,
+	       (u32_t)(((u64_t)TOTAL_MSGS * sys_clock_hw_cycles_per_sec()) /
+		       cycles), checksum);
+}
+
+void main(void)
+{
+	int prio = k_thread_priority_get(k_current_get());
+
+	printk("k_msgq throughput, %u byte messages, %u deep, %u messages\n",
+	       (u32_t)sizeof(struct msg), QUEUE_LEN, TOTAL_MSGS);
+
+	run(1, prio);
+	run(8, prio);
+	run(32, prio);
+
+	printk("fin\n");
+}
@@ -0,0 +1,141 @@
+/*
+ * Copyright (c) 2019 Intel Corporation
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr.h>
+#include <misc/printk.h>
+
+/* Streams TOTAL_BYTES through a pipe in blocks, once with the copying
+ * API and once with claim/commit, and reports the throughput.
+ */
+
+#define PIPE_SIZE 1024
+#define TOTAL_BYTES (256 * 1024)
+#define MAX_BLOCK 256
+#define STACK_SIZE 1024
+
+static unsigned char __aligned(4) pipe_buf[PIPE_SIZE];
+static struct k_pipe pipe;
+
+static K_THREAD_STACK_DEFINE(consumer_stack, STACK_SIZE);
+static struct k_thread consumer_thread;
+static K_SEM_DEFINE(consumer_done, 0, 1);
+
+static size_t block_size;
+static bool use_claim;
+static u32_t checksum;
+
+static void generate(unsigned char *dst, size_t len, u32_t offset)
+{
+	for (size_t i = 0; i < len; i++) {
+		dst[i] = (unsigned char)(offset + i);
+	}
+}
+
+static u32_t sum(const unsigned char *src, size_t len)
+{
+	u32_t s = 0U;
+
+	for (size_t i = 0; i < len; i++) {
+		s += src[i];
+	}
+
+	return s;
+}
+
+static void consumer(void *arg1, void *arg2, void *arg3)
+{
+	unsigned char block[MAX_BLOCK];
+	size_t done = 0;
+
+	ARG_UNUSED(arg1);
+	ARG_UNUSED(arg2);
+	ARG_UNUSED(arg3);
+
+	checksum = 0U;
+
+	while (done < TOTAL_BYTES) {
+		if (use_claim) {
+			unsigned char *p;
+			size_t len = block_size;
+
+			k_pipe_get_claim(&pipe, (void **)&p, &len, K_FOREVER);
+			checksum += sum(p, len);
+			k_pipe_get_commit(&pipe, len);
+			done += len;
+		} else {
+			size_t len;
+
+			k_pipe_get(&pipe, block, block_size, &len, block_size,
+				   K_FOREVER);
+			checksum += sum(block, len);
+			done += len;
+		}
+	}
+
+	k_sem_give(&consumer_done);
+}
+
+static void produce(void)
+{
+	unsigned char block[MAX_BLOCK];
+	size_t done = 0;
+
+	while (done < TOTAL_BYTES) {
+		if (use_claim) {
+			unsigned char *p;
+			size_t len = block_size;
+
+			k_pipe_put_claim(&pipe, (void **)&p, &len, K_FOREVER);
+			generate(p, len, done);
+			k_pipe_put_commit(&pipe, len);
+			done += len;
+		} else {
+			size_t len;
+
+			generate(block, block_size, done);
+			k_pipe_put(&pipe, block, block_size, &len, block_size,
+				   K_FOREVER);
+			done += len;
+		}
+	}
+}
+
+static void run(size_t size, bool claim, int prio)
+{
+	u32_t start, cycles;
+
+	k_pipe_init(&pipe, pipe_buf, sizeof(pipe_buf));
+	block_size = size;
+	use_claim = claim;
+
+	k_thread_create(&consumer_thread, consumer_stack, STACK_SIZE,
+			consumer, NULL, NULL, NULL, prio, 0, 0);
+
+	start = k_cycle_get_32();
+	produce();
+	k_sem_take(&consumer_done, K_FOREVER);
+	cycles = k_cycle_get_32() - start;
+
+	printk("%-12s block %3u: %u bytes/sec (checksum %08x)\n",
+	       claim ? "claim/commit" : "put/get", (u32_t)size,
+	       (u32_t)(((u64_t)TOTAL_BYTES * sys_clock_hw_cycles_per_sec()) /
+		       cycles), checksum);
+}
+
+void main(void)
+{
+	int prio = k_thread_priority_get(k_current_get());
+
+	printk("k_pipe throughput, %u byte pipe, %u bytes per run\n",
+	       PIPE_SIZE, TOTAL_BYTES);
+
+	for (size_t size = 16; size <= MAX_BLOCK; size *= 4) {
+		run(size, false, prio);
+		run(size, true, prio);
+	}
+
+	printk("fin\n");
+}
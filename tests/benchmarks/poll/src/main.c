@@ -0,0 +1,150 @@
+/*
+ * Copyright (c) 2019 Intel Corporation
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr.h>
+#include <misc/printk.h>
+
+/* A higher priority thread waits on NUM_SOURCES semaphores while main
+ * gives a random one of them at a time and waits for the waiter to
+ * consume it.  Round trips are timed for k_poll() and for poll sets.
+ */
+
+#define NUM_SOURCES 64
+#define ROUNDS 2000
+#define STACK_SIZE 1024
+
+enum mode {
+	MODE_POLL,
+	MODE_SET_LEVEL,
+	MODE_SET_EDGE,
+};
+
+static const char *const mode_names[] = {
+	"k_poll()", "poll set (level)", "poll set (edge)",
+};
+
+static struct k_sem sources[NUM_SOURCES];
+static struct k_poll_event events[NUM_SOURCES];
+static struct k_poll_set set;
+static K_SEM_DEFINE(ack, 0, 1);
+
+static K_THREAD_STACK_DEFINE(waiter_stack, STACK_SIZE);
+static struct k_thread waiter_thread;
+
+/* Cheap deterministic LCG so every mode sees the same sources */
+static u32_t rand_state;
+
+static u32_t next_rand(void)
+{
+	rand_state = rand_state * 1103515245U + 12345U;
+	return rand_state >> 16;
+}
+
+static void consume(struct k_poll_event *event)
+{
+	if (k_sem_take(event->sem, K_NO_WAIT) == 0) {
+		k_sem_give(&ack);
+	}
+}
+
+static void poll_waiter(void)
+{
+	for (int r = 0; r < ROUNDS; r++) {
+		for (int i = 0; i < NUM_SOURCES; i++) {
+			events[i].state = K_POLL_STATE_NOT_READY;
+		}
+
+		k_poll(events, NUM_SOURCES, K_FOREVER);
+
+		for (int i = 0; i < NUM_SOURCES; i++) {
+			if (events[i].state != K_POLL_STATE_NOT_READY) {
+				consume(&events[i]);
+			}
+		}
+	}
+}
+
+static void set_waiter(void)
+{
+	struct k_poll_event *ready[4];
+
+	for (int r = 0; r < ROUNDS; r++) {
+		int n = k_poll_set_wait(&set, ready, ARRAY_SIZE(ready),
+					K_FOREVER);
+
+		for (int i = 0; i < n; i++) {
+			consume(ready[i]);
+		}
+	}
+}
+
+static void waiter(void *arg1, void *arg2, void *arg3)
+{
+	ARG_UNUSED(arg2);
+	ARG_UNUSED(arg3);
+
+	if ((enum mode)arg1 == MODE_POLL) {
+		poll_waiter();
+	} else {
+		set_waiter();
+	}
+}
+
+static void run(enum mode mode, int prio)
+{
+	u32_t start, cycles;
+
+	for (int i = 0; i < NUM_SOURCES; i++) {
+		k_sem_init(&sources[i], 0, 1);
+		k_poll_event_init(&events[i], K_POLL_TYPE_SEM_AVAILABLE,
+				  K_POLL_MODE_NOTIFY_ONLY, &sources[i]);
+	}
+
+	if (mode != MODE_POLL) {
+		k_poll_set_init(&set,
+				mode == MODE_SET_EDGE ? K_POLL_SET_EDGE : 0);
+		for (int i = 0; i < NUM_SOURCES; i++) {
+			k_poll_set_add(&set, &events[i]);
+		}
+	}
+
+	k_thread_create(&waiter_thread, waiter_stack, STACK_SIZE, waiter,
+			(void *)mode, NULL, NULL, prio, 0, 0);
+
+	rand_state = 1U;
+	start = k_cycle_get_32();
+
+	for (int r = 0; r < ROUNDS; r++) {
+		k_sem_give(&sources[next_rand() % NUM_SOURCES]);
+		k_sem_take(&ack, K_FOREVER);
+	}
+
+	cycles = k_cycle_get_32() - start;
+
+	k_thread_abort(&waiter_thread);
+
+	if (mode != MODE_POLL) {
+		for (int i = 0; i < NUM_SOURCES; i++) {
+			k_poll_set_remove(&set, &events[i]);
+		}
+	}
+
+	printk("%-17s: %u cycles/wakeup\n", mode_names[mode],
+	       cycles / ROUNDS);
+}
+
+void main(void)
+{
+	int prio = k_thread_priority_get(k_current_get()) - 1;
+
+	printk("Waking 1 of %d idle sources\n", NUM_SOURCES);
+
+	run(MODE_POLL, prio);
+	run(MODE_SET_LEVEL, prio);
+	run(MODE_SET_EDGE, prio);
+
+	printk("fin\n");
+}
@@ -95,6 +95,112 @@ static void partner_fn(void *arg1, void *arg2, void *arg3)
 	}
 }
 
+#if CONFIG_BENCHMARK_SCHED_READY_THREADS > 0
+#define N_READY CONFIG_BENCHMARK_SCHED_READY_THREADS
+
+static K_THREAD_STACK_ARRAY_DEFINE(ready_stacks, N_READY, 512);
+static struct k_thread ready_threads[N_READY];
+
+static void ready_fn(void *arg1, void *arg2, void *arg3)
+{
+	ARG_UNUSED(arg1);
+	ARG_UNUSED(arg2);
+	ARG_UNUSED(arg3);
+
+	while (true) {
+	}
+}
+
+/* Fill the run queue with threads that never block, spread over all
+ * priorities below the ones used by the measurement
+ */
+static void fill_ready_q(int main_prio)
+{
+	int base = main_prio + 2;
+	int n_prios = K_LOWEST_APPLICATION_THREAD_PRIO - base + 1;
+
+	for (int i = 0; i < N_READY; i++) {
+		k_thread_create(&ready_threads[i], ready_stacks[i],
+				K_THREAD_STACK_SIZEOF(ready_stacks[i]),
+				ready_fn, NULL, NULL, NULL,
+				base + (i % n_prios), 0, 0);
+	}
+}
+#endif
+
+#if defined(CONFIG_SMP) && defined(CONFIG_SCHED_CPU_MASK)
+/* SMP throughput test: two threads pinned to each of the first
+ * N CPUs yield to each other for SWITCH_TEST_MS, and every k_yield()
+ * is counted as one context switch.  This measures how well the
+ * scheduler scales as more CPUs hit it concurrently.
+ */
+#define SWITCH_TEST_MS 1000
+#define MAX_SWITCH_THREADS (2 * CONFIG_MP_NUM_CPUS)
+
+static K_THREAD_STACK_ARRAY_DEFINE(switch_stacks, MAX_SWITCH_THREADS, 1024);
+static struct k_thread switch_threads[MAX_SWITCH_THREADS];
+static u32_t switch_counts[MAX_SWITCH_THREADS];
+static volatile bool switch_stop;
+static K_SEM_DEFINE(switch_done, 0, MAX_SWITCH_THREADS);
+
+static void switch_fn(void *arg1, void *arg2, void *arg3)
+{
+	u32_t *count = arg1;
+
+	ARG_UNUSED(arg2);
+	ARG_UNUSED(arg3);
+
+	while (!switch_stop) {
+		k_yield();
+		(*count)++;
+	}
+
+	k_sem_give(&switch_done);
+}
+
+static void switch_rate(int n_cpus, int prio)
+{
+	int n_threads = 2 * n_cpus;
+	u64_t total = 0;
+
+	switch_stop = false;
+
+	for (int i = 0; i < n_threads; i++) {
+		switch_counts[i] = 0;
+		k_thread_create(&switch_threads[i], switch_stacks[i],
+				K_THREAD_STACK_SIZEOF(switch_stacks[i]),
+				switch_fn, &switch_counts[i], NULL, NULL,
+				prio, 0, K_FOREVER);
+		k_thread_cpu_mask_clear(&switch_threads[i]);
+		k_thread_cpu_mask_enable(&switch_threads[i], i / 2);
+	}
+
+	for (int i = 0; i < n_threads; i++) {
+		k_thread_start(&switch_threads[i]);
+	}
+
+	k_sleep(SWITCH_TEST_MS);
+	switch_stop = true;
+
+	for (int i = 0; i < n_threads; i++) {
+		k_sem_take(&switch_done, K_FOREVER);
+		total += switch_counts[i];
+	}
+
+	printk("SMP %d CPU(s): %u context switches/sec\n", n_cpus,
+	       (u32_t)(total * 1000 / SWITCH_TEST_MS));
+}
+
+static void smp_switch_rates(void)
+{
+	int prio = k_thread_priority_get(k_current_get()) + 1;
+
+	for (int n = 1; n <= CONFIG_MP_NUM_CPUS; n *= 2) {
+		switch_rate(n, prio);
+	}
+}
+#endif
+
 void main(void)
 {
 	z_waitq_init(&waitq);
@@ -107,6 +213,11 @@ void main(void)
 				     partner_fn, NULL, NULL, NULL,
 				     partner_prio, 0, 0);
 
+#if CONFIG_BENCHMARK_SCHED_READY_THREADS > 0
+	fill_ready_q(main_prio);
+	printk("%d extra threads ready\n", N_READY);
+#endif
+
 	/* Let it start running and pend */
 	k_sleep(100);
 
@@ -157,5 +268,9 @@ void main(void)
 		       stamps[4] - stamps[3],
 		       whole, avg);
 	}
+
+#if defined(CONFIG_SMP) && defined(CONFIG_SCHED_CPU_MASK)
+	smp_switch_rates();
+#endif
 	printk("fin\n");
 }
@@ -0,0 +1,91 @@
+/*
+ * Copyright (c) 2019 Intel Corporation
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr.h>
+#include <misc/printk.h>
+#include <timeout_q.h>
+
+/* Measures the cost of z_add_timeout() and z_abort_timeout() with a
+ * varying number of other timeouts already pending.  The backend
+ * under test is selected with CONFIG_TIMEOUT_QUEUE_*.
+ */
+
+#define MAX_PENDING 1000
+#define N_RUNS 1000
+
+/* Pending expiries are spread over this range (in ticks), starting
+ * far enough out that nothing fires while we measure
+ */
+#define BASE_TICKS 100000
+#define SPREAD_TICKS 100000
+
+static struct _timeout pending[MAX_PENDING];
+static struct _timeout probe;
+
+static void dummy_fn(struct _timeout *t)
+{
+	ARG_UNUSED(t);
+}
+
+/* Cheap deterministic LCG so runs are repeatable across backends */
+static u32_t rand_state = 1U;
+
+static u32_t next_rand(void)
+{
+	rand_state = rand_state * 1103515245U + 12345U;
+	return rand_state >> 16;
+}
+
+static void run(int n_pending)
+{
+	u32_t add_tot = 0U, abort_tot = 0U;
+	u32_t add_max = 0U, abort_max = 0U;
+
+	for (int i = 0; i < n_pending; i++) {
+		z_init_timeout(&pending[i], dummy_fn);
+		z_add_timeout(&pending[i], dummy_fn,
+			      BASE_TICKS + next_rand() % SPREAD_TICKS);
+	}
+
+	z_init_timeout(&probe, dummy_fn);
+
+	for (int i = 0; i < N_RUNS; i++) {
+		u32_t t0, t1, t2;
+
+		t0 = k_cycle_get_32();
+		z_add_timeout(&probe, dummy_fn, BASE_TICKS + SPREAD_TICKS / 2);
+		t1 = k_cycle_get_32();
+		z_abort_timeout(&probe);
+		t2 = k_cycle_get_32();
+
+		add_tot += t1 - t0;
+		abort_tot += t2 - t1;
+		add_max = MAX(add_max, t1 - t0);
+		abort_max = MAX(abort_max, t2 - t1);
+	}
+
+	printk("pending %4d: arm avg %5u max %5u, cancel avg %5u max %5u\n",
+	       n_pending, add_tot / N_RUNS, add_max,
+	       abort_tot / N_RUNS, abort_max);
+
+	for (int i = 0; i < n_pending; i++) {
+		z_abort_timeout(&pending[i]);
+	}
+}
+
+void main(void)
+{
+	static const int sizes[] = { 10, 100, 1000 };
+
+	printk("timeout queue benchmark (%s backend), in cycles\n",
+	       IS_ENABLED(CONFIG_TIMEOUT_QUEUE_WHEEL) ? "wheel" : "dlist");
+
+	for (int i = 0; i < ARRAY_SIZE(sizes); i++) {
+		run(sizes[i]);
+	}
+
+	printk("fin\n");
+}
@@ -0,0 +1,99 @@
+/*
+ * Copyright (c) 2019 Intel Corporation
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr.h>
+#include <misc/printk.h>
+
+/* Runs NUM_ITEMS self re-arming delayed work items for RUN_MS, with and
+ * without slack, and counts how many distinct wakeups they needed.
+ */
+
+#define NUM_ITEMS 24
+#define RUN_MS (60 * MSEC_PER_SEC)
+#define SLACK_MS 50
+
+struct item {
+	struct k_delayed_work work;
+	s32_t period;
+};
+
+static struct item items[NUM_ITEMS];
+
+static u32_t rand_state;
+static bool running;
+static u32_t expirations;
+static u32_t wakeups;
+static u32_t last_fired;
+
+static u32_t next_rand(void)
+{
+	rand_state = rand_state * 1103515245U + 12345U;
+	return rand_state >> 16;
+}
+
+/* Period plus up to 1/8 of it as jitter */
+static s32_t next_delay(struct item *it)
+{
+	return it->period + next_rand() % (it->period / 8 + 1);
+}
+
+static void item_handler(struct k_work *work)
+{
+	struct item *it = CONTAINER_OF(work, struct item, work.work);
+	u32_t now = k_uptime_get_32();
+
+	expirations++;
+	if (expirations == 1U || now != last_fired) {
+		wakeups++;
+		last_fired = now;
+	}
+
+	if (running) {
+		k_delayed_work_submit(&it->work, next_delay(it));
+	}
+}
+
+static void run(s32_t slack)
+{
+	u32_t saved = k_timeout_wakeups_saved();
+
+	rand_state = 0xC0FFEEU;
+	expirations = 0U;
+	wakeups = 0U;
+	running = true;
+
+	for (int i = 0; i < NUM_ITEMS; i++) {
+		/* a mix of short, medium and long periods */
+		items[i].period = 100 + (next_rand() % 3) * 400 +
+				  next_rand() % 100;
+		k_delayed_work_init(&items[i].work, item_handler);
+		k_delayed_work_slack_set(&items[i].work, slack);
+		k_delayed_work_submit(&items[i].work, next_delay(&items[i]));
+	}
+
+	k_sleep(RUN_MS);
+
+	running = false;
+	for (int i = 0; i < NUM_ITEMS; i++) {
+		k_delayed_work_cancel(&items[i].work);
+	}
+	/* let an item that was already being handled finish */
+	k_sleep(10);
+
+	printk("slack %3d ms: %u expirations, %u wakeups, %u saved\n",
+	       slack, expirations, wakeups,
+	       k_timeout_wakeups_saved() - saved);
+}
+
+void main(void)
+{
+	printk("%d delayed work items over %d ms\n", NUM_ITEMS, RUN_MS);
+
+	run(0);
+	run(SLACK_MS);
+
+	printk("fin\n");
+}
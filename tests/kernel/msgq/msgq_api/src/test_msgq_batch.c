@@ -0,0 +1,152 @@
+/*
+ * Copyright (c) 2019 Intel Corporation
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "test_msgq.h"
+
+#define BATCH_LEN 8
+
+K_THREAD_STACK_EXTERN(tstack);
+extern struct k_thread tdata;
+static char __aligned(4) bbuffer[MSG_SIZE * BATCH_LEN];
+static struct k_msgq bmsgq;
+
+static void writer_entry(void *p1, void *p2, void *p3)
+{
+	u32_t msg = POINTER_TO_UINT(p2);
+
+	zassert_equal(k_msgq_put((struct k_msgq *)p1, &msg, K_FOREVER), 0,
+		      NULL);
+}
+
+/**
+ * @addtogroup kernel_message_queue_tests
+ * @{
+ */
+
+/**
+ * @brief Test moving several messages per call
+ * @see k_msgq_put_many(), k_msgq_get_many()
+ */
+void test_msgq_put_get_many(void)
+{
+	u32_t tx[BATCH_LEN + 2], rx[BATCH_LEN + 2];
+	int i;
+
+	k_msgq_init(&bmsgq, bbuffer, MSG_SIZE, BATCH_LEN);
+
+	for (i = 0; i < ARRAY_SIZE(tx); i++) {
+		tx[i] = MSG0 + i;
+	}
+
+	/**TESTPOINT: only as many messages as fit are sent*/
+	zassert_equal(k_msgq_put_many(&bmsgq, tx, 3, K_NO_WAIT), 3, NULL);
+	zassert_equal(k_msgq_put_many(&bmsgq, &tx[3], BATCH_LEN, K_NO_WAIT),
+		      BATCH_LEN - 3, NULL);
+	zassert_equal(k_msgq_put_many(&bmsgq, tx, 1, K_NO_WAIT), -ENOMSG,
+		      NULL);
+	zassert_equal(k_msgq_put_many(&bmsgq, tx, 1, TIMEOUT), -EAGAIN,
+		      NULL);
+
+	/**TESTPOINT: messages come out in order, partially*/
+	zassert_equal(k_msgq_get_many(&bmsgq, rx, 2, K_NO_WAIT), 2, NULL);
+	zassert_equal(k_msgq_get_many(&bmsgq, &rx[2], ARRAY_SIZE(rx) - 2,
+				      K_NO_WAIT), BATCH_LEN - 2, NULL);
+	for (i = 0; i < BATCH_LEN; i++) {
+		zassert_equal(rx[i], tx[i], NULL);
+	}
+
+	zassert_equal(k_msgq_get_many(&bmsgq, rx, BATCH_LEN, K_NO_WAIT),
+		      -ENOMSG, NULL);
+	zassert_equal(k_msgq_get_many(&bmsgq, rx, BATCH_LEN, TIMEOUT),
+		      -EAGAIN, NULL);
+	zassert_equal(k_msgq_put_many(&bmsgq, tx, 0, K_NO_WAIT), 0, NULL);
+	zassert_equal(k_msgq_get_many(&bmsgq, rx, 0, K_NO_WAIT), 0, NULL);
+}
+
+/**
+ * @brief Test that a batched receive admits a blocked sender in order
+ * @see k_msgq_put_many(), k_msgq_get_many()
+ */
+void test_msgq_get_many_pend_writer(void)
+{
+	u32_t tx[BATCH_LEN], rx[BATCH_LEN + 1];
+	int i;
+
+	k_msgq_init(&bmsgq, bbuffer, MSG_SIZE, BATCH_LEN);
+
+	for (i = 0; i < BATCH_LEN; i++) {
+		tx[i] = MSG1 + i;
+	}
+	zassert_equal(k_msgq_put_many(&bmsgq, tx, BATCH_LEN, K_NO_WAIT),
+		      BATCH_LEN, NULL);
+
+	k_thread_create(&tdata, tstack, STACK_SIZE, writer_entry,
+			&bmsgq, UINT_TO_POINTER(MSG0), NULL,
+			K_PRIO_PREEMPT(0), 0, 0);
+	k_sleep(TIMEOUT >> 1);
+
+	/**TESTPOINT: the pended message follows the queued ones*/
+	zassert_equal(k_msgq_get_many(&bmsgq, rx, ARRAY_SIZE(rx), K_NO_WAIT),
+		      BATCH_LEN + 1, NULL);
+	for (i = 0; i < BATCH_LEN; i++) {
+		zassert_equal(rx[i], tx[i], NULL);
+	}
+	zassert_equal(rx[BATCH_LEN], MSG0, NULL);
+
+	k_thread_abort(&tdata);
+}
+
+/**
+ * @brief Test that urgent messages overtake regular ones
+ * @see k_msgq_put_urgent()
+ */
+void test_msgq_put_urgent(void)
+{
+#ifdef CONFIG_MSGQ_PRIORITY
+	u32_t msg, rx[BATCH_LEN];
+	int i;
+
+	k_msgq_init(&bmsgq, bbuffer, MSG_SIZE, BATCH_LEN);
+
+	for (i = 0; i < 4; i++) {
+		msg = MSG1 + i;
+		zassert_equal(k_msgq_put(&bmsgq, &msg, K_NO_WAIT), 0, NULL);
+	}
+	for (i = 0; i < 3; i++) {
+		msg = MSG0 + i;
+		zassert_equal(k_msgq_put_urgent(&bmsgq, &msg, K_NO_WAIT), 0,
+			      NULL);
+	}
+
+	/**TESTPOINT: urgent messages first, each class in FIFO order*/
+	zassert_equal(k_msgq_peek(&bmsgq, &msg), 0, NULL);
+	zassert_equal(msg, MSG0, NULL);
+	zassert_equal(k_msgq_get_many(&bmsgq, rx, BATCH_LEN, K_NO_WAIT), 7,
+		      NULL);
+	for (i = 0; i < 3; i++) {
+		zassert_equal(rx[i], MSG0 + i, NULL);
+	}
+	for (i = 0; i < 4; i++) {
+		zassert_equal(rx[3 + i], MSG1 + i, NULL);
+	}
+
+	/**TESTPOINT: purge drops the urgent accounting too*/
+	msg = MSG0;
+	zassert_equal(k_msgq_put_urgent(&bmsgq, &msg, K_NO_WAIT), 0, NULL);
+	k_msgq_purge(&bmsgq);
+	zassert_equal(k_msgq_num_used_get(&bmsgq), 0, NULL);
+	msg = MSG1;
+	zassert_equal(k_msgq_put(&bmsgq, &msg, K_NO_WAIT), 0, NULL);
+	zassert_equal(k_msgq_get(&bmsgq, &msg, K_NO_WAIT), 0, NULL);
+	zassert_equal(msg, MSG1, NULL);
+#else
+	ztest_test_skip();
+#endif
+}
+
+/**
+ * @}
+ */
@@ -0,0 +1,133 @@
+/*
+ * Copyright (c) 2019 Intel Corporation
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <ztest.h>
+
+#define CLAIM_PIPE_LEN 16
+#define STACK_SIZE (512 + CONFIG_TEST_EXTRA_STACKSIZE)
+#define TIMEOUT 100
+
+static unsigned char __aligned(4) claim_buf[CLAIM_PIPE_LEN];
+static struct k_pipe claim_pipe;
+
+static K_THREAD_STACK_DEFINE(claim_stack, STACK_SIZE);
+static struct k_thread claim_thread;
+
+/**
+ * @brief Test claim/commit on both ends of a pipe, including wrap-around
+ * @ingroup kernel_pipe_tests
+ * @see k_pipe_put_claim(), k_pipe_put_commit(), k_pipe_get_claim(),
+ * k_pipe_get_commit()
+ */
+void test_pipe_claim_commit(void)
+{
+	unsigned char *p;
+	size_t size;
+
+	k_pipe_init(&claim_pipe, claim_buf, sizeof(claim_buf));
+
+	/* empty pipe: nothing to read */
+	size = 4;
+	zassert_equal(k_pipe_get_claim(&claim_pipe, (void **)&p, &size,
+				       K_NO_WAIT), -EIO, NULL);
+	zassert_equal(k_pipe_get_claim(&claim_pipe, (void **)&p, &size,
+				       TIMEOUT), -EAGAIN, NULL);
+
+	/* claim 12 bytes, commit only 10 */
+	size = 12;
+	zassert_equal(k_pipe_put_claim(&claim_pipe, (void **)&p, &size,
+				       K_NO_WAIT), 0, NULL);
+	zassert_equal(size, 12, NULL);
+	zassert_equal(k_pipe_put_claim(&claim_pipe, (void **)&p, &size,
+				       K_NO_WAIT), -EBUSY, NULL);
+	for (int i = 0; i < 10; i++) {
+		p[i] = i;
+	}
+	zassert_equal(k_pipe_put_commit(&claim_pipe, 13), -EINVAL, NULL);
+	zassert_equal(k_pipe_put_commit(&claim_pipe, 10), 0, NULL);
+
+	/* consume 8 in place, leave 2 */
+	size = CLAIM_PIPE_LEN;
+	zassert_equal(k_pipe_get_claim(&claim_pipe, (void **)&p, &size,
+				       K_NO_WAIT), 0, NULL);
+	zassert_equal(size, 10, NULL);
+	zassert_equal(p[0], 0, NULL);
+	zassert_equal(k_pipe_get_commit(&claim_pipe, 8), 0, NULL);
+
+	/* free space wraps: only the 6 bytes up to the end are contiguous */
+	size = CLAIM_PIPE_LEN;
+	zassert_equal(k_pipe_put_claim(&claim_pipe, (void **)&p, &size,
+				       K_NO_WAIT), 0, NULL);
+	zassert_equal(size, 6, NULL);
+	for (int i = 0; i < 6; i++) {
+		p[i] = 10 + i;
+	}
+	zassert_equal(k_pipe_put_commit(&claim_pipe, 6), 0, NULL);
+
+	/* the copying API sees the same stream */
+	unsigned char out[8];
+	size_t bytes_read;
+
+	zassert_equal(k_pipe_get(&claim_pipe, out, sizeof(out), &bytes_read,
+				 1, K_NO_WAIT), 0, NULL);
+	zassert_equal(bytes_read, 8, NULL);
+	for (int i = 0; i < 8; i++) {
+		zassert_equal(out[i], 8 + i, NULL);
+	}
+}
+
+static void claim_reader(void *p1, void *p2, void *p3)
+{
+	unsigned char out[4];
+	size_t bytes_read;
+
+	ARG_UNUSED(p1);
+	ARG_UNUSED(p2);
+	ARG_UNUSED(p3);
+
+	k_pipe_get(&claim_pipe, out, sizeof(out), &bytes_read, sizeof(out),
+		   K_FOREVER);
+}
+
+/**
+ * @brief Test that claims wait for and wake up the other end
+ * @ingroup kernel_pipe_tests
+ * @see k_pipe_put_claim(), k_pipe_get_claim()
+ */
+void test_pipe_claim_wait(void)
+{
+	unsigned char *p;
+	size_t size, bytes_written;
+
+	k_pipe_init(&claim_pipe, claim_buf, sizeof(claim_buf));
+
+	/* a blocked k_pipe_get() reader is served by a put commit */
+	k_thread_create(&claim_thread, claim_stack, STACK_SIZE, claim_reader,
+			NULL, NULL, NULL, K_PRIO_PREEMPT(0), 0, 0);
+	k_sleep(TIMEOUT / 2);
+
+	size = 4;
+	zassert_equal(k_pipe_put_claim(&claim_pipe, (void **)&p, &size,
+				       K_NO_WAIT), 0, NULL);
+	zassert_equal(k_pipe_put_commit(&claim_pipe, size), 0, NULL);
+	k_sleep(TIMEOUT / 2);
+	zassert_equal(claim_pipe.bytes_used, 0, NULL);
+
+	/* fill the pipe, then a put claim waits for a k_pipe_get() */
+	zassert_equal(k_pipe_put(&claim_pipe, claim_buf, CLAIM_PIPE_LEN,
+				 &bytes_written, CLAIM_PIPE_LEN, K_NO_WAIT),
+		      0, NULL);
+	size = 4;
+	zassert_equal(k_pipe_put_claim(&claim_pipe, (void **)&p, &size,
+				       TIMEOUT), -EAGAIN, NULL);
+
+	k_thread_create(&claim_thread, claim_stack, STACK_SIZE, claim_reader,
+			NULL, NULL, NULL, K_PRIO_PREEMPT(0), 0, 0);
+	zassert_equal(k_pipe_put_claim(&claim_pipe, (void **)&p, &size,
+				       K_FOREVER), 0, NULL);
+	zassert_equal(size, 4, NULL);
+	zassert_equal(k_pipe_put_commit(&claim_pipe, 0), 0, NULL);
+}
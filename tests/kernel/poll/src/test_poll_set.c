@@ -0,0 +1,184 @@
+/*
+ * Copyright (c) 2019 Intel Corporation
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <ztest.h>
+#include <kernel.h>
+
+#ifdef CONFIG_POLL_SET
+
+#define NUM_SEMS 4
+#define STACK_SIZE (1024 + CONFIG_TEST_EXTRA_STACKSIZE)
+
+static struct k_sem set_sems[NUM_SEMS];
+static struct k_poll_event set_events[NUM_SEMS];
+static struct k_poll_set set;
+
+static K_THREAD_STACK_DEFINE(set_stack, STACK_SIZE);
+static struct k_thread set_thread;
+
+static void set_setup(u32_t flags)
+{
+	k_poll_set_init(&set, flags);
+
+	for (int i = 0; i < NUM_SEMS; i++) {
+		k_sem_init(&set_sems[i], 0, 10);
+		k_poll_event_init(&set_events[i], K_POLL_TYPE_SEM_AVAILABLE,
+				  K_POLL_MODE_NOTIFY_ONLY, &set_sems[i]);
+		set_events[i].tag = i;
+		k_poll_set_add(&set, &set_events[i]);
+	}
+}
+
+static void set_teardown(void)
+{
+	for (int i = 0; i < NUM_SEMS; i++) {
+		k_poll_set_remove(&set, &set_events[i]);
+	}
+}
+
+/**
+ * @brief Test level-triggered poll set
+ *
+ * @ingroup kernel_poll_tests
+ *
+ * @see k_poll_set_init(), k_poll_set_add(), k_poll_set_wait()
+ */
+void test_poll_set_level(void)
+{
+	struct k_poll_event *ready[NUM_SEMS];
+
+	set_setup(0);
+
+	zassert_equal(k_poll_set_wait(&set, ready, NUM_SEMS, K_NO_WAIT),
+		      -EAGAIN, "");
+
+	/* repeated signals are coalesced into one report */
+	k_sem_give(&set_sems[2]);
+	k_sem_give(&set_sems[2]);
+	zassert_equal(k_poll_set_wait(&set, ready, NUM_SEMS, K_NO_WAIT), 1,
+		      "");
+	zassert_equal(ready[0], &set_events[2], "");
+	zassert_equal(ready[0]->state, K_POLL_STATE_SEM_AVAILABLE, "");
+
+	/* still available: reported again */
+	zassert_equal(k_sem_take(&set_sems[2], K_NO_WAIT), 0, "");
+	zassert_equal(k_poll_set_wait(&set, ready, NUM_SEMS, K_NO_WAIT), 1,
+		      "");
+	zassert_equal(ready[0], &set_events[2], "");
+
+	/* drained: dropped from the ready list */
+	zassert_equal(k_sem_take(&set_sems[2], K_NO_WAIT), 0, "");
+	zassert_equal(k_poll_set_wait(&set, ready, NUM_SEMS, K_NO_WAIT),
+		      -EAGAIN, "");
+
+	/* only the ready subset is returned, in order */
+	k_sem_give(&set_sems[3]);
+	k_sem_give(&set_sems[0]);
+	zassert_equal(k_poll_set_wait(&set, ready, NUM_SEMS, K_NO_WAIT), 2,
+		      "");
+	zassert_equal(ready[0], &set_events[3], "");
+	zassert_equal(ready[1], &set_events[0], "");
+
+	set_teardown();
+}
+
+/**
+ * @brief Test edge-triggered poll set
+ *
+ * @ingroup kernel_poll_tests
+ *
+ * @see k_poll_set_init(), k_poll_set_wait()
+ */
+void test_poll_set_edge(void)
+{
+	struct k_poll_event *ready[NUM_SEMS];
+
+	set_setup(K_POLL_SET_EDGE);
+
+	k_sem_give(&set_sems[1]);
+	k_sem_give(&set_sems[1]);
+	zassert_equal(k_poll_set_wait(&set, ready, NUM_SEMS, K_NO_WAIT), 1,
+		      "");
+	zassert_equal(ready[0], &set_events[1], "");
+
+	/* no new transition: not reported again, although available */
+	zassert_equal(k_poll_set_wait(&set, ready, NUM_SEMS, K_NO_WAIT),
+		      -EAGAIN, "");
+
+	k_sem_give(&set_sems[1]);
+	zassert_equal(k_poll_set_wait(&set, ready, NUM_SEMS, K_NO_WAIT), 1,
+		      "");
+	zassert_equal(ready[0], &set_events[1], "");
+
+	set_teardown();
+}
+
+static void set_giver(void *p1, void *p2, void *p3)
+{
+	ARG_UNUSED(p1);
+	ARG_UNUSED(p2);
+	ARG_UNUSED(p3);
+
+	k_sleep(50);
+	k_sem_give(&set_sems[3]);
+}
+
+/**
+ * @brief Test waiting on a poll set, alongside a k_poll() waiter
+ *
+ * @ingroup kernel_poll_tests
+ *
+ * @see k_poll_set_wait(), k_poll()
+ */
+void test_poll_set_wait(void)
+{
+	struct k_poll_event *ready[NUM_SEMS];
+	struct k_poll_event event;
+
+	set_setup(0);
+
+	zassert_equal(k_poll_set_wait(&set, ready, NUM_SEMS, 20), -EAGAIN,
+		      "");
+
+	k_thread_create(&set_thread, set_stack, STACK_SIZE, set_giver,
+			NULL, NULL, NULL, K_PRIO_PREEMPT(0), 0, 0);
+
+	zassert_equal(k_poll_set_wait(&set, ready, NUM_SEMS, K_FOREVER), 1,
+		      "");
+	zassert_equal(ready[0], &set_events[3], "");
+
+	/* k_poll() on an object that also belongs to a set */
+	k_poll_event_init(&event, K_POLL_TYPE_SEM_AVAILABLE,
+			  K_POLL_MODE_NOTIFY_ONLY, &set_sems[0]);
+	k_sem_give(&set_sems[0]);
+	zassert_equal(k_poll(&event, 1, K_FOREVER), 0, "");
+	zassert_equal(event.state, K_POLL_STATE_SEM_AVAILABLE, "");
+
+	/* both semaphores are still available */
+	zassert_equal(k_poll_set_wait(&set, ready, NUM_SEMS, K_NO_WAIT), 2,
+		      "");
+
+	set_teardown();
+}
+
+#else
+
+void test_poll_set_level(void)
+{
+	ztest_test_skip();
+}
+
+void test_poll_set_edge(void)
+{
+	ztest_test_skip();
+}
+
+void test_poll_set_wait(void)
+{
+	ztest_test_skip();
+}
+
+#endif /* CONFIG_POLL_SET */
@@ -503,6 +503,66 @@ void test_delayed_work_cancel_isr(void)
 	}
 }
 
+#ifdef CONFIG_TIMEOUT_SLACK
+static u32_t slack_fired[NUM_OF_WORK];
+
+static void slack_work_handler(struct k_work *w)
+{
+	for (int i = 0; i < NUM_OF_WORK; i++) {
+		if (w == &delayed_work[i].work) {
+			slack_fired[i] = k_uptime_get_32();
+		}
+	}
+
+	k_sem_give(&sync_sema);
+}
+#endif
+
+/**
+ * @brief Test delayed work submission with slack
+ *
+ * @ingroup kernel_workqueue_tests
+ *
+ * @see k_delayed_work_slack_set(), k_timeout_wakeups_saved()
+ */
+void test_delayed_work_slack(void)
+{
+#ifdef CONFIG_TIMEOUT_SLACK
+	u32_t start, saved;
+	u32_t tick_ms = __ticks_to_ms(1);
+
+	k_sem_reset(&sync_sema);
+	saved = k_timeout_wakeups_saved();
+
+	start = k_uptime_get_32();
+	for (int i = 0; i < NUM_OF_WORK; i++) {
+		k_delayed_work_init(&delayed_work[i], slack_work_handler);
+		k_delayed_work_slack_set(&delayed_work[i], TIMEOUT);
+		zassert_equal(k_delayed_work_submit_to_queue(&workq,
+							     &delayed_work[i],
+							     TIMEOUT), 0,
+			      NULL);
+	}
+
+	for (int i = 0; i < NUM_OF_WORK; i++) {
+		k_sem_take(&sync_sema, K_FOREVER);
+	}
+
+	/**TESTPOINT: never early, at most slack late*/
+	for (int i = 0; i < NUM_OF_WORK; i++) {
+		zassert_true(slack_fired[i] - start >= TIMEOUT, NULL);
+		zassert_true(slack_fired[i] - start <=
+			     2 * TIMEOUT + 2 * tick_ms, NULL);
+	}
+
+	/**TESTPOINT: the items shared one timer announcement*/
+	zassert_true(k_timeout_wakeups_saved() >= saved + NUM_OF_WORK - 1,
+		     NULL);
+#else
+	ztest_test_skip();
+#endif
+}
+
 
 void test_main(void)
 {
@@ -535,6 +595,7 @@ void test_main(void)
 			 ztest_unit_test(test_delayed_work_cancel_from_queue_thread),
 			 ztest_unit_test(test_delayed_work_cancel_from_queue_isr),
 			 ztest_unit_test(test_delayed_work_cancel_thread),
-			 ztest_unit_test(test_delayed_work_cancel_isr));
+			 ztest_unit_test(test_delayed_work_cancel_isr),
+			 ztest_unit_test(test_delayed_work_slack));
 	ztest_run_test_suite(workqueue_api);
 }
@@ -254,6 +254,93 @@ void test_memcmp(void)
 	zassert_true((ret != 0), "memcmp 5");
 }
 
+/**
+ *
+ * @brief Test memory copy functions across alignments
+ *
+ */
+
+void test_memcpy_alignment(void)
+{
+	u8_t src[64], dst[64], ref[64];
+
+	for (int i = 0; i < sizeof(src); i++) {
+		src[i] = i + 1;
+	}
+
+	for (int s_off = 0; s_off < 8; s_off++) {
+		for (int d_off = 0; d_off < 8; d_off++) {
+			for (size_t n = 0; n <= 40; n += 13) {
+				(void)memset(dst, 0, sizeof(dst));
+				(void)memset(ref, 0, sizeof(ref));
+				for (size_t i = 0; i < n; i++) {
+					ref[d_off + i] = src[s_off + i];
+				}
+
+				memcpy(dst + d_off, src + s_off, n);
+				zassert_true(memcmp(dst, ref, sizeof(dst)) == 0,
+					     "memcpy %d %d %d", s_off, d_off,
+					     (int)n);
+			}
+		}
+	}
+}
+
+/**
+ *
+ * @brief Test overlapping memory moves in both directions
+ *
+ */
+
+void test_memmove_overlap(void)
+{
+	u8_t buf[64];
+
+	for (int shift = -9; shift <= 9; shift++) {
+		for (int i = 0; i < sizeof(buf); i++) {
+			buf[i] = i;
+		}
+
+		memmove(buf + 16 + shift, buf + 16, 32);
+		for (int i = 0; i < 32; i++) {
+			zassert_equal(buf[16 + shift + i], 16 + i,
+				      "memmove %d", shift);
+		}
+	}
+}
+
+/**
+ *
+ * @brief Test that word-wise scans find bytes at every offset
+ *
+ */
+
+void test_strlen_strchr_offsets(void)
+{
+	char str[40];
+
+	for (int start = 0; start < 8; start++) {
+		for (int len = 0; len < 24; len++) {
+			(void)memset(str, 'x', sizeof(str));
+			str[start + len] = '\0';
+			if (len > 0) {
+				str[start + len / 2] = 'y';
+			}
+
+			zassert_equal(strlen(str + start), len, "strlen");
+			zassert_equal(strchr(str + start, 'y'),
+				      len ? &str[start + len / 2] : NULL,
+				      "strchr");
+			zassert_equal(strchr(str + start, '\0'),
+				      &str[start + len], "strchr nul");
+			zassert_is_null(strchr(str + start, 'z'), "strchr");
+		}
+	}
+
+	/* bytes with the top bit set compare as unsigned */
+	zassert_true(memcmp("\x80", "\x01", 1) > 0, "memcmp unsigned");
+}
+
 void test_main(void)
 {
 	ztest_test_suite(test_c_lib,
@@ -267,7 +354,10 @@ void test_main(void)
 			 ztest_unit_test(test_strncpy),
 			 ztest_unit_test(test_memset),
 			 ztest_unit_test(test_strlen),
-			 ztest_unit_test(test_strcmp)
+			 ztest_unit_test(test_strcmp),
+			 ztest_unit_test(test_memcpy_alignment),
+			 ztest_unit_test(test_memmove_overlap),
+			 ztest_unit_test(test_strlen_strchr_offsets)
 			 );
 	ztest_run_test_suite(test_c_lib);
 }
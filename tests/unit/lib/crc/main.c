@@ -121,6 +121,89 @@ void test_crc7_be(void)
 	zassert_equal(crc7_be(0, test2, sizeof(test2)), 0xEA, NULL);
 }
 
+/* Bitwise references for cross-checking the table-driven variants */
+static u32_t ref_crc32_ieee(u32_t crc, const u8_t *data, size_t len)
+{
+	crc = ~crc;
+	while (len--) {
+		crc ^= *data++;
+		for (int b = 0; b < 8; b++) {
+			crc = (crc >> 1) ^ ((crc & 1) ? 0xEDB88320 : 0);
+		}
+	}
+
+	return ~crc;
+}
+
+static u16_t ref_crc16_reflected(u16_t crc, const u8_t *data, size_t len)
+{
+	while (len--) {
+		crc ^= *data++;
+		for (int b = 0; b < 8; b++) {
+			crc = (crc >> 1) ^ ((crc & 1) ? 0x8408 : 0);
+		}
+	}
+
+	return crc;
+}
+
+static u16_t ref_crc16_msb(u16_t crc, const u8_t *data, size_t len)
+{
+	while (len--) {
+		crc ^= (u16_t)*data++ << 8;
+		for (int b = 0; b < 8; b++) {
+			crc = (crc << 1) ^ ((crc & 0x8000) ? 0x1021 : 0);
+		}
+	}
+
+	return crc;
+}
+
+static u8_t ref_crc8_msb(u8_t crc, const u8_t *data, size_t len)
+{
+	while (len--) {
+		crc ^= *data++;
+		for (int b = 0; b < 8; b++) {
+			crc = (crc << 1) ^ ((crc & 0x80) ? 0x07 : 0);
+		}
+	}
+
+	return crc;
+}
+
+void test_crc_reference(void)
+{
+	static u8_t buf[96];
+	u32_t rnd = 12345;
+
+	for (size_t i = 0; i < sizeof(buf); i++) {
+		rnd = rnd * 1103515245 + 12345;
+		buf[i] = rnd >> 16;
+	}
+
+	/* Every length and start offset, to cover the sliced loops and
+	 * their byte-wise tails
+	 */
+	for (int off = 0; off < 8; off++) {
+		for (int len = 0; len <= (int)sizeof(buf) - off; len++) {
+			const u8_t *p = buf + off;
+
+			zassert_equal(crc32_ieee_update(off, p, len),
+				      ref_crc32_ieee(off, p, len),
+				      "crc32 off %d len %d", off, len);
+			zassert_equal(crc16_ccitt(0xffff, p, len),
+				      ref_crc16_reflected(0xffff, p, len),
+				      "crc16_ccitt off %d len %d", off, len);
+			zassert_equal(crc16_itu_t(0x1d0f, p, len),
+				      ref_crc16_msb(0x1d0f, p, len),
+				      "crc16_itu_t off %d len %d", off, len);
+			zassert_equal(crc8_ccitt(0xff, p, len),
+				      ref_crc8_msb(0xff, p, len),
+				      "crc8_ccitt off %d len %d", off, len);
+		}
+	}
+}
+
 void test_main(void)
 {
 	ztest_test_suite(test_crc,
@@ -131,6 +214,7 @@ void test_main(void)
 			 ztest_unit_test(test_crc16_ccitt_for_ppp),
 			 ztest_unit_test(test_crc16_itu_t),
 			 ztest_unit_test(test_crc8_ccitt),
-			 ztest_unit_test(test_crc7_be));
+			 ztest_unit_test(test_crc7_be),
+			 ztest_unit_test(test_crc_reference));
 	ztest_run_test_suite(test_crc);
 }